@@ -14,6 +14,8 @@ void Animation::setSpeed(GLfloat speed) {
 
 void Animation::play(Model* model,
     GLfloat deltaTime) {
+    PROFILE_ZONE("Animation::play");
+
     // update current frame
     m_frame += 0.5f * m_speed * deltaTime;
     m_keyframe = static_cast<GLuint>(m_frame) % (m_keyframeLast + 1);
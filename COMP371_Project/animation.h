@@ -4,6 +4,7 @@
 // project headers
 #include "animation_step.h"
 #include "model.h"
+#include "profiler.h"
 
 class Animation {
 public:
@@ -0,0 +1,78 @@
+#include "benchmark_statistics.h"
+
+// C++ standard library headers
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+GLdouble BenchmarkStatistics::getMax() const {
+    // get largest sample
+    if (m_samples.empty())
+        return 0.0;
+
+    return *std::max_element(m_samples.begin(), m_samples.end());
+}
+
+GLdouble BenchmarkStatistics::getMean() const {
+    // get arithmetic mean of samples
+    if (m_samples.empty())
+        return 0.0;
+
+    GLdouble sum{ 0.0 };
+    for (std::vector<GLdouble>::const_iterator it{ m_samples.begin() };
+        it != m_samples.end();
+        ++it)
+        sum += *it;
+
+    return sum / m_samples.size();
+}
+
+GLdouble BenchmarkStatistics::getMin() const {
+    // get smallest sample
+    if (m_samples.empty())
+        return 0.0;
+
+    return *std::min_element(m_samples.begin(), m_samples.end());
+}
+
+GLdouble BenchmarkStatistics::getPercentile(GLdouble percentile) const {
+    // get sample below which the given percentage of samples fall
+    // (nearest-rank method)
+    if (m_samples.empty())
+        return 0.0;
+
+    std::vector<GLdouble> sorted{ m_samples };
+    std::sort(sorted.begin(), sorted.end());
+    GLuint rank = static_cast<GLuint>(
+        std::ceil(percentile / 100.0 * sorted.size()));
+
+    return sorted.at(std::max(rank, 1u) - 1);
+}
+
+GLuint BenchmarkStatistics::getSampleCount() const {
+    // get number of samples
+    return m_samples.size();
+}
+
+void BenchmarkStatistics::add(GLdouble sample) {
+    // add sample
+    m_samples.push_back(sample);
+}
+
+void BenchmarkStatistics::clear() {
+    // remove all samples
+    m_samples.clear();
+}
+
+std::string BenchmarkStatistics::toJSON() const {
+    // format summary as a JSON object
+    std::stringstream ss;
+    ss << "{ \"min\": " << getMin()
+        << ", \"mean\": " << getMean()
+        << ", \"p50\": " << getPercentile(50.0)
+        << ", \"p99\": " << getPercentile(99.0)
+        << ", \"max\": " << getMax()
+        << " }";
+
+    return ss.str();
+}
\ No newline at end of file
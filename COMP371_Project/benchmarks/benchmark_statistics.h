@@ -0,0 +1,32 @@
+#ifndef BENCHMARK_STATISTICS_H
+#define BENCHMARK_STATISTICS_H
+
+// GLEW
+#include <gl/glew.h>
+
+// C++ standard library headers
+#include <string>
+#include <vector>
+
+// summary statistics over a series of timing samples
+class BenchmarkStatistics {
+public:
+    BenchmarkStatistics() {}
+
+    // getters
+    GLdouble getMax() const;
+    GLdouble getMean() const;
+    GLdouble getMin() const;
+    GLdouble getPercentile(GLdouble percentile) const;
+    GLuint getSampleCount() const;
+
+    // utilities
+    void add(GLdouble sample);
+    void clear();
+    std::string toJSON() const;
+
+private:
+    std::vector<GLdouble> m_samples;
+};
+
+#endif // !BENCHMARK_STATISTICS_H
\ No newline at end of file
@@ -0,0 +1,332 @@
+// CPU microbenchmarks for the simulation kernels: collision detection, model
+// matrix composition, animation playback, path traversal and particle update,
+// each run over herds of increasing size
+//
+// usage: cpu_benchmark [--counts N,N,...] [--budget SECONDS]
+//     [--iterations N] [--limit SECONDS] [--delta SECONDS] [--output PATH]
+//     [--paths N] [--config PATH]
+//
+// a count is skipped for a kernel when a single iteration is projected to
+// take longer than the limit, scaling the fastest iteration at the previous
+// count by the kernel's complexity (collision detection is quadratic)
+//
+// an offscreen context is still created, as model entities share a vertex
+// array object that is generated on construction
+
+// project headers
+#include "../animation.h"
+#include "../collision.h"
+#include "../config.h"
+#include "../constants.h"
+#include "../horse_factory.h"
+#include "../model.h"
+#include "../particle.h"
+#include "../particle_system.h"
+#include "../path.h"
+#include "benchmark_statistics.h"
+#include "headless_context.h"
+
+// GLEW
+#include <gl/glew.h>
+
+// GLM
+#include <glm/glm.hpp>
+
+// C++ standard library headers
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+struct CPUBenchmarkOptions {
+    std::vector<GLuint> counts{ 40, 400, 4000, 40000 };
+    std::string output{ "cpu_benchmark.json" };
+    GLdouble budget{ 1.0 };
+    GLdouble limit{ 10.0 };
+    GLfloat deltaTime{ 1.0f / 60.0f };
+    GLuint iterations{ 100 };
+};
+
+// a herd of horses built the same way as the renderer builds its troop
+struct Herd {
+    Herd(GLuint count) {
+        // models, animations and paths
+        for (GLuint i{ 0 }; i != count; ++i) {
+            animations.push_back(HorseFactory::createAnimation());
+            models.push_back(HorseFactory::createModel(nullptr,
+                entities,
+                joints));
+            paths.push_back(HorseFactory::createPath());
+
+            // same scale and random placement as the renderer
+            GLfloat scale = std::min(1.0f
+                + 10.0f * TRANSFORMATION_INCREMENT_SCALING,
+                TRANSFORMATION_SCALE_MAX);
+            models.at(i)->scale(glm::vec3(scale));
+            if (i != 0) {
+                models.at(i)->setPosition(glm::vec3(
+                    static_cast<GLfloat>(rand() % GRID_SIZE - POSITION_MAX),
+                    MODEL_POSITION_RELATIVE_TORSO.y,
+                    static_cast<GLfloat>(rand() % GRID_SIZE - POSITION_MAX)));
+                models.at(i)->rotate(static_cast<GLfloat>(rand() % 360),
+                    AXIS_Y);
+            }
+        }
+
+        // rain particles, in the same proportion to the troop as in the scene
+        GLuint particleCount = count * PARTICLE_COUNT_PER_TROOP;
+        for (GLuint i{ 0 }; i != particleCount; ++i) {
+            particles.push_back(new Particle());
+            particles.at(i)->m_life = -1.0f;
+            particles.at(i)->m_position.y = -1000.0f;
+            particles.at(i)->m_distanceToCamera = -1.0f;
+        }
+        particlePositions.resize(particleCount);
+    }
+    Herd(const Herd& herd) = delete;
+    Herd& operator=(Herd& herd) = delete;
+    ~Herd() {
+        // free resources (collision state refers to the models)
+        Collision::clear();
+        for (GLuint i{ 0 }; i != models.size(); ++i) {
+            delete animations.at(i);
+            delete models.at(i);
+            delete paths.at(i);
+        }
+        for (GLuint i{ 0 }; i != entities.size(); ++i)
+            delete entities.at(i);
+        for (GLuint i{ 0 }; i != joints.size(); ++i)
+            delete joints.at(i);
+        for (GLuint i{ 0 }; i != particles.size(); ++i)
+            delete particles.at(i);
+    }
+
+    std::vector<Animation*> animations;
+    std::vector<Joint*> joints;
+    std::vector<Model*> models;
+    std::vector<Particle*> particles;
+    std::vector<Path*> paths;
+    std::vector<RenderedEntity*> entities;
+    std::vector<glm::vec3> particlePositions;
+};
+
+// kernels (the returned value is only used to keep the work observable)
+GLfloat runCollision(Herd& herd,
+    GLfloat) {
+    // detect collisions between every pair of horses
+    return static_cast<GLfloat>(
+        Collision::detectCollisions(herd.models).size());
+}
+
+GLfloat runModelMatrix(Herd& herd,
+    GLfloat) {
+    // compose the model matrix of every body part
+    GLfloat sink{ 0.0f };
+    for (GLuint i{ 0 }; i != herd.models.size(); ++i) {
+        Model::ModelHierarchy* hierarchy = herd.models.at(i)->getHierarchy();
+        for (Model::ModelHierarchy::const_iterator it{ hierarchy->begin() };
+            it != hierarchy->end();
+            ++it)
+            sink += herd.models.at(i)->getModelMatrix(it->first)[3][0];
+    }
+
+    return sink;
+}
+
+GLfloat runAnimation(Herd& herd,
+    GLfloat deltaTime) {
+    // advance every horse's gallop animation
+    for (GLuint i{ 0 }; i != herd.models.size(); ++i) {
+        herd.animations.at(i)->setSpeed(ANIMATION_SPEED);
+        herd.animations.at(i)->play(herd.models.at(i), deltaTime);
+    }
+
+    return herd.models.at(0)->getJointRotation(JOINT_HEAD);
+}
+
+GLfloat runPath(Herd& herd,
+    GLfloat deltaTime) {
+    // advance every horse along its path
+    for (GLuint i{ 0 }; i != herd.models.size(); ++i)
+        herd.paths.at(i)->traverse(herd.models.at(i), deltaTime);
+
+    return herd.models.at(0)->getOrientation();
+}
+
+GLfloat runParticles(Herd& herd,
+    GLfloat deltaTime) {
+    // respawn and advance rain particles
+    return static_cast<GLfloat>(ParticleSystem::update(herd.particles,
+        deltaTime,
+        CAMERA_POSITION,
+        &herd.particlePositions[0]));
+}
+
+// kernel cost grows with the entity count to the power of its exponent
+struct Kernel {
+    const char* name;
+    GLfloat (*run)(Herd& herd, GLfloat deltaTime);
+    GLdouble exponent;
+};
+
+const Kernel KERNELS[]{
+    { "collision", runCollision, 2.0 },
+    { "model_matrix", runModelMatrix, 1.0 },
+    { "animation", runAnimation, 1.0 },
+    { "path", runPath, 1.0 },
+    { "particles", runParticles, 1.0 }
+};
+const GLuint KERNEL_COUNT{ sizeof(KERNELS) / sizeof(KERNELS[0]) };
+
+bool parseOptions(int argc,
+    char* argv[],
+    CPUBenchmarkOptions& options) {
+    // read command line options
+    for (int i{ 1 }; i < argc; ++i) {
+        std::string arg{ argv[i] };
+        bool hasValue{ i + 1 < argc };
+
+        if (arg == "--counts" && hasValue) {
+            options.counts.clear();
+            std::stringstream ss(argv[++i]);
+            std::string count;
+            while (std::getline(ss, count, ','))
+                if (std::atoi(count.c_str()) > 0)
+                    options.counts.push_back(
+                        static_cast<GLuint>(std::atoi(count.c_str())));
+        }
+        else if (arg == "--budget" && hasValue)
+            options.budget = std::atof(argv[++i]);
+        else if (arg == "--limit" && hasValue)
+            options.limit = std::atof(argv[++i]);
+        else if (arg == "--iterations" && hasValue)
+            options.iterations = static_cast<GLuint>(std::atoi(argv[++i]));
+        else if (arg == "--delta" && hasValue)
+            options.deltaTime = static_cast<GLfloat>(std::atof(argv[++i]));
+        else if (arg == "--output" && hasValue)
+            options.output = argv[++i];
+        else {
+            std::cerr << ">>> Unknown or incomplete option: " << arg
+                << std::endl;
+
+            return false;
+        }
+    }
+
+    if (options.counts.empty() || options.iterations == 0) {
+        std::cerr << ">>> Entity counts and iterations must be positive"
+            << std::endl;
+
+        return false;
+    }
+
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    CPUBenchmarkOptions options;
+    if (!Config::get().load(argc, argv)
+        || !parseOptions(argc, argv, options))
+        return 1;
+
+    // create offscreen context
+    HeadlessContext context(1, 1);
+    if (!context.isValid())
+        return 1;
+
+    // fixed rand seed and movement speed, as in a 60 Hz frame
+    srand(0);
+    Model::setSpeedCurrent(Model::getSpeed() * options.deltaTime);
+
+    // run every kernel over every herd size, for a bounded number of
+    // iterations or until the time budget is spent (at least once)
+    std::vector<BenchmarkStatistics> results(KERNEL_COUNT
+        * options.counts.size());
+    std::vector<GLdouble> previousMin(KERNEL_COUNT, 0.0);
+    std::vector<GLuint> previousCount(KERNEL_COUNT, 0);
+    GLfloat sink{ 0.0f };
+    for (GLuint c{ 0 }; c != options.counts.size(); ++c) {
+        Herd herd(options.counts.at(c));
+
+        for (GLuint k{ 0 }; k != KERNEL_COUNT; ++k) {
+            // project a single iteration from the previous count measured
+            GLdouble projected{ previousCount.at(k) == 0
+                ? 0.0
+                : previousMin.at(k) * std::pow(
+                    static_cast<GLdouble>(options.counts.at(c))
+                    / previousCount.at(k),
+                    KERNELS[k].exponent) };
+            if (projected > options.limit * 1000.0) {
+                std::cout << KERNELS[k].name << " x" << options.counts.at(c)
+                    << ": skipped (projected " << projected << " ms)"
+                    << std::endl;
+                continue;
+            }
+
+            BenchmarkStatistics& stats = results.at(k * options.counts.size()
+                + c);
+            std::chrono::high_resolution_clock::time_point budgetStart{
+                std::chrono::high_resolution_clock::now() };
+
+            do {
+                std::chrono::high_resolution_clock::time_point start{
+                    std::chrono::high_resolution_clock::now() };
+                sink += KERNELS[k].run(herd, options.deltaTime);
+                stats.add(std::chrono::duration<GLdouble, std::milli>(
+                    std::chrono::high_resolution_clock::now() - start).count());
+            } while (stats.getSampleCount() < options.iterations
+                && std::chrono::duration<GLdouble>(
+                    std::chrono::high_resolution_clock::now()
+                    - budgetStart).count() < options.budget);
+
+            std::cout << KERNELS[k].name << " x" << options.counts.at(c)
+                << ": " << stats.getMean() << " ms ("
+                << stats.getSampleCount() << " iterations)" << std::endl;
+            previousMin.at(k) = stats.getMin();
+            previousCount.at(k) = options.counts.at(c);
+        }
+    }
+
+    // write results as JSON (one scaling curve per kernel)
+    std::ofstream file(options.output);
+    if (!file) {
+        std::cerr << ">>> Failed to open benchmark output: "
+            << options.output << std::endl;
+
+        return 1;
+    }
+
+    file << "{" << std::endl
+        << "  \"delta_time\": " << options.deltaTime << "," << std::endl
+        << "  \"kernels\": {" << std::endl;
+    for (GLuint k{ 0 }; k != KERNEL_COUNT; ++k) {
+        file << "    \"" << KERNELS[k].name << "\": [" << std::endl;
+        for (GLuint c{ 0 }; c != options.counts.size(); ++c) {
+            const BenchmarkStatistics& stats = results.at(
+                k * options.counts.size() + c);
+            file << "      { \"count\": " << options.counts.at(c)
+                << ", \"iterations\": " << stats.getSampleCount();
+            if (stats.getSampleCount() == 0)
+                file << ", \"skipped\": true";
+            else
+                file << ", \"ns_per_entity\": "
+                    << stats.getMean() * 1.0e6 / options.counts.at(c)
+                    << ", \"time_ms\": " << stats.toJSON();
+            file << " }"
+                << (c + 1 != options.counts.size() ? "," : "") << std::endl;
+        }
+        file << "    ]" << (k + 1 != KERNEL_COUNT ? "," : "") << std::endl;
+    }
+    file << "  }" << std::endl
+        << "}" << std::endl;
+
+    std::cout << "Results written to " << options.output
+        << " (checksum " << sink << ")" << std::endl;
+
+    return 0;
+}
\ No newline at end of file
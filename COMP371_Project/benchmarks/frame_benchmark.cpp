@@ -0,0 +1,304 @@
+// headless frame benchmark: renders a fixed number of frames offscreen with
+// a fixed time step and reports frame and per-stage timings as JSON
+//
+// usage: frame_benchmark [--frames N] [--warmup N] [--delta SECONDS]
+//     [--output PATH] [--gpu-csv PATH] [--trace PATH] [--startup-report PATH]
+//     [--no-sync] [--rain]
+//     [--animations] [--pathing] [--day-night] [--hud] [--adaptive-shadows]
+//     [scene options]
+//
+// shadow quality stays fixed unless --adaptive-shadows is given, so that
+// runs on different machines render the same work
+//
+// scene options (--troops N, --grass N, --config PATH, ...) are read by
+// Config, so the same binary can sweep scene sizes
+//
+// must be run from the project directory so shader and texture paths resolve
+
+// project headers
+#include "../camera.h"
+#include "../config.h"
+#include "../constants.h"
+#include "../gl_counters.h"
+#include "../gpu_timer.h"
+#include "../model.h"
+#include "../profiler.h"
+#include "../recorder.h"
+#include "../renderer.h"
+#include "../stage_timer.h"
+#include "../startup_report.h"
+#include "benchmark_statistics.h"
+#include "headless_context.h"
+
+// GLEW
+#include <gl/glew.h>
+
+// C++ standard library headers
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+struct FrameBenchmarkOptions {
+    std::string output{ "frame_benchmark.json" };
+    std::string gpuCSV;
+    std::string startupReport;
+    std::string trace;
+    GLfloat deltaTime{ 1.0f / 60.0f };
+    GLuint frames{ 600 };
+    GLuint warmup{ 60 };
+    bool adaptiveShadows{ false };
+    bool animations{ false };
+    bool dayNight{ false };
+    bool hud{ false };
+    bool pathing{ false };
+    bool rain{ false };
+    bool synchronous{ true };
+};
+
+bool parseOptions(int argc,
+    char* argv[],
+    FrameBenchmarkOptions& options) {
+    // read command line options
+    for (int i{ 1 }; i < argc; ++i) {
+        std::string arg{ argv[i] };
+        bool hasValue{ i + 1 < argc };
+
+        if (arg == "--frames" && hasValue)
+            options.frames = static_cast<GLuint>(std::atoi(argv[++i]));
+        else if (arg == "--warmup" && hasValue)
+            options.warmup = static_cast<GLuint>(std::atoi(argv[++i]));
+        else if (arg == "--delta" && hasValue)
+            options.deltaTime = static_cast<GLfloat>(std::atof(argv[++i]));
+        else if (arg == "--output" && hasValue)
+            options.output = argv[++i];
+        else if (arg == "--gpu-csv" && hasValue)
+            options.gpuCSV = argv[++i];
+        else if (arg == "--trace" && hasValue)
+            options.trace = argv[++i];
+        else if (arg == "--startup-report" && hasValue)
+            options.startupReport = argv[++i];
+        else if (arg == "--no-sync")
+            options.synchronous = false;
+        else if (arg == "--adaptive-shadows")
+            options.adaptiveShadows = true;
+        else if (arg == "--animations")
+            options.animations = true;
+        else if (arg == "--day-night")
+            options.dayNight = true;
+        else if (arg == "--hud")
+            options.hud = true;
+        else if (arg == "--pathing")
+            options.pathing = true;
+        else if (arg == "--rain")
+            options.rain = true;
+        else {
+            std::cerr << ">>> Unknown or incomplete option: " << arg
+                << std::endl;
+
+            return false;
+        }
+    }
+
+    if (options.frames == 0) {
+        std::cerr << ">>> Frame count must be positive" << std::endl;
+
+        return false;
+    }
+
+    return true;
+}
+
+void writeStages(std::ostream& out,
+    const BenchmarkStatistics* stageStats) {
+    // write per-stage statistics as JSON object members
+    for (GLuint i{ 0 }; i != Timing::STAGE_COUNT; ++i) {
+        out << "    \"" << TIMING_STAGE_NAMES[i] << "\": "
+            << stageStats[i].toJSON()
+            << (i + 1 != Timing::STAGE_COUNT ? "," : "") << std::endl;
+    }
+}
+
+std::string countsToJSON(Timing::Stage stage,
+    bool wholeFrame) {
+    // format GL call counts of last frame (or one of its stages) as JSON
+    std::stringstream ss;
+    ss << "{ ";
+    for (GLuint i{ 0 }; i != GLCalls::COUNTER_COUNT; ++i) {
+        GLCalls::Counter counter = static_cast<GLCalls::Counter>(i);
+        ss << "\"" << GL_COUNTER_NAMES[i] << "\": "
+            << (wholeFrame
+                ? GLCounters::getFrameCount(counter)
+                : GLCounters::getStageCount(stage, counter))
+            << (i + 1 != GLCalls::COUNTER_COUNT ? ", " : " }");
+    }
+
+    return ss.str();
+}
+
+void writeReport(std::ostream& out,
+    const FrameBenchmarkOptions& options,
+    const BenchmarkStatistics& frameStats,
+    const BenchmarkStatistics* stageStats,
+    const BenchmarkStatistics& gpuFrameStats,
+    const BenchmarkStatistics* gpuStageStats) {
+    // write results as JSON
+    out << "{" << std::endl
+        << "  \"renderer\": \"" << glGetString(GL_RENDERER) << "\","
+        << std::endl
+        << "  \"version\": \"" << glGetString(GL_VERSION) << "\","
+        << std::endl
+        << "  \"frames\": " << options.frames << "," << std::endl
+        << "  \"warmup\": " << options.warmup << "," << std::endl
+        << "  \"delta_time\": " << options.deltaTime << "," << std::endl
+        << "  \"synchronous\": "
+        << (options.synchronous ? "true" : "false") << "," << std::endl
+        << "  \"troop_count\": " << Config::get().getTroopCount() << ","
+        << std::endl
+        << "  \"grass_count\": " << Config::get().getGrassCount() << ","
+        << std::endl
+        << "  \"particle_count\": " << Config::get().getParticleCount()
+        << "," << std::endl
+        << "  \"shadow_size\": " << Config::get().getShadowSize() << ","
+        << std::endl
+        << "  \"frame_time_ms\": " << frameStats.toJSON() << ","
+        << std::endl
+        << "  \"stage_time_ms\": {" << std::endl;
+    writeStages(out, stageStats);
+    out << "  }," << std::endl
+        << "  \"gpu_frames\": " << gpuFrameStats.getSampleCount() << ","
+        << std::endl
+        << "  \"gpu_frame_time_ms\": " << gpuFrameStats.toJSON() << ","
+        << std::endl
+        << "  \"gpu_stage_time_ms\": {" << std::endl;
+    writeStages(out, gpuStageStats);
+    out << "  }," << std::endl
+        << "  \"gl_calls_last_frame\": "
+        << countsToJSON(Timing::STAGE_COUNT, true) << "," << std::endl
+        << "  \"gl_calls_last_frame_stages\": {" << std::endl;
+    for (GLuint i{ 0 }; i != Timing::STAGE_COUNT; ++i) {
+        out << "    \"" << TIMING_STAGE_NAMES[i] << "\": "
+            << countsToJSON(static_cast<Timing::Stage>(i), false)
+            << (i + 1 != Timing::STAGE_COUNT ? "," : "") << std::endl;
+    }
+    out << "  }" << std::endl
+        << "}" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    FrameBenchmarkOptions options;
+    if (!Config::get().load(argc, argv)
+        || !parseOptions(argc, argv, options))
+        return 1;
+
+    // create offscreen context
+    HeadlessContext context(SCREEN_WIDTH, SCREEN_HEIGHT);
+    if (!context.isValid())
+        return 1;
+
+    // same fixed-function state as the interactive application
+    GLState::setViewport(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+    GLState::setCullFace(GL_BACK);
+    GLState::setCapability(GL_DEPTH_TEST, true);
+    GLState::setDepthFunc(GL_LESS);
+    GLState::setCapability(GL_BLEND, true);
+    GLState::setBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    Camera::get().setViewportDimensions(SCREEN_WIDTH, SCREEN_HEIGHT);
+
+    // fixed rand seed so every run renders the same scene (the renderer
+    // seeds rand() from the recorder)
+    Recorder::get().setSeed(0);
+
+    // construct renderer and apply requested toggles
+    {
+        STARTUP_SCOPE("Renderer::Renderer");
+        Renderer::get();
+    }
+    Renderer& renderer = Renderer::get();
+    if (options.animations)
+        renderer.toggleAnimations();
+    if (options.dayNight)
+        renderer.toggleDayNightCycle();
+    if (options.pathing)
+        renderer.togglePathing();
+    if (options.rain)
+        renderer.toggleRain();
+    if (!options.hud)
+        renderer.toggleHud();
+    if (!options.adaptiveShadows && renderer.isShadowBudgetEnabled())
+        renderer.toggleShadowBudget();
+
+    // movement speeds are scaled by the fixed time step, as in main loop
+    Camera::get().setSpeedCurrent(Camera::get().getSpeed()
+        * options.deltaTime);
+    Model::setSpeedCurrent(Model::getSpeed()
+        * options.deltaTime);
+
+    StageTimer::setSynchronous(options.synchronous);
+
+    // warm up (shader compilation, texture uploads, driver caches)
+    for (GLuint i{ 0 }; i != options.warmup; ++i) {
+        renderer.render(options.deltaTime);
+        glFinish();
+    }
+
+    // measure
+    BenchmarkStatistics frameStats;
+    BenchmarkStatistics stageStats[Timing::STAGE_COUNT];
+    BenchmarkStatistics gpuFrameStats;
+    BenchmarkStatistics gpuStageStats[Timing::STAGE_COUNT];
+    GLuint gpuFramesResolved = GPUTimer::getFramesResolved();
+    for (GLuint i{ 0 }; i != options.frames; ++i) {
+        PROFILE_ZONE("frame");
+        std::chrono::high_resolution_clock::time_point start{
+            std::chrono::high_resolution_clock::now() };
+
+        renderer.render(options.deltaTime);
+        glFinish();
+
+        frameStats.add(std::chrono::duration<GLdouble, std::milli>(
+            std::chrono::high_resolution_clock::now() - start).count());
+        for (GLuint j{ 0 }; j != Timing::STAGE_COUNT; ++j)
+            stageStats[j].add(StageTimer::getStageTime(
+                static_cast<Timing::Stage>(j)));
+
+        // GPU timings arrive a few frames late, only count new ones
+        if (GPUTimer::getFramesResolved() != gpuFramesResolved) {
+            gpuFramesResolved = GPUTimer::getFramesResolved();
+            gpuFrameStats.add(GPUTimer::getFrameTime());
+            for (GLuint j{ 0 }; j != Timing::STAGE_COUNT; ++j)
+                gpuStageStats[j].add(GPUTimer::getStageTime(
+                    static_cast<Timing::Stage>(j)));
+        }
+    }
+
+    // write report to file and summary to console
+    std::ofstream file(options.output);
+    if (!file) {
+        std::cerr << ">>> Failed to open benchmark output: "
+            << options.output << std::endl;
+
+        return 1;
+    }
+    writeReport(file,
+        options,
+        frameStats,
+        stageStats,
+        gpuFrameStats,
+        gpuStageStats);
+    if (!options.gpuCSV.empty())
+        GPUTimer::writeCSV(options.gpuCSV);
+    if (!options.trace.empty())
+        Profiler::writeTrace(options.trace);
+    if (!options.startupReport.empty())
+        StartupReport::writeJSON(options.startupReport);
+
+    std::cout << "Frames: " << options.frames << std::endl
+        << "Frame time (ms): " << frameStats.toJSON() << std::endl
+        << "Results written to " << options.output << std::endl;
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,123 @@
+#include "headless_context.h"
+
+// EGL tokens that older headers may not define
+#ifndef EGL_PLATFORM_SURFACELESS_MESA
+#define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+#endif
+#ifndef EGL_CONTEXT_MAJOR_VERSION
+#define EGL_CONTEXT_MAJOR_VERSION 0x3098
+#define EGL_CONTEXT_MINOR_VERSION 0x30FB
+#define EGL_CONTEXT_OPENGL_PROFILE_MASK 0x30FD
+#define EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT 0x00000001
+#endif
+
+HeadlessContext::~HeadlessContext() {
+    // release context and surface
+    if (m_display == EGL_NO_DISPLAY)
+        return;
+
+    eglMakeCurrent(m_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if (m_context != EGL_NO_CONTEXT)
+        eglDestroyContext(m_display, m_context);
+    if (m_surface != EGL_NO_SURFACE)
+        eglDestroySurface(m_display, m_surface);
+    eglTerminate(m_display);
+}
+
+bool HeadlessContext::isValid() const {
+    // get whether context was successfully made current
+    return m_valid;
+}
+
+void HeadlessContext::initialize(GLuint width,
+    GLuint height) {
+    // open and initialize display
+    m_display = openDisplay();
+    if (m_display == EGL_NO_DISPLAY
+        || !eglInitialize(m_display, NULL, NULL)) {
+        std::cerr << ">>> Failed to initialize EGL display" << std::endl;
+        m_display = EGL_NO_DISPLAY;
+
+        return;
+    }
+
+    // choose a pbuffer-capable desktop OpenGL configuration
+    const EGLint configAttributes[] = {
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_RED_SIZE, 8,
+        EGL_GREEN_SIZE, 8,
+        EGL_BLUE_SIZE, 8,
+        EGL_ALPHA_SIZE, 8,
+        EGL_DEPTH_SIZE, 24,
+        EGL_NONE
+    };
+    EGLConfig config;
+    EGLint configCount{ 0 };
+    if (!eglChooseConfig(m_display, configAttributes, &config, 1, &configCount)
+        || configCount == 0) {
+        std::cerr << ">>> Failed to find suitable EGL configuration" << std::endl;
+
+        return;
+    }
+
+    // pbuffer stands in for the window's default framebuffer
+    const EGLint surfaceAttributes[] = {
+        EGL_WIDTH, static_cast<EGLint>(width),
+        EGL_HEIGHT, static_cast<EGLint>(height),
+        EGL_NONE
+    };
+    m_surface = eglCreatePbufferSurface(m_display, config, surfaceAttributes);
+    if (m_surface == EGL_NO_SURFACE) {
+        std::cerr << ">>> Failed to create EGL pbuffer surface" << std::endl;
+
+        return;
+    }
+
+    // create OpenGL 3.3 core context, same as the windowed application
+    const EGLint contextAttributes[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 3,
+        EGL_CONTEXT_MINOR_VERSION, 3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+    eglBindAPI(EGL_OPENGL_API);
+    m_context = eglCreateContext(m_display, config, EGL_NO_CONTEXT, contextAttributes);
+    if (m_context == EGL_NO_CONTEXT
+        || !eglMakeCurrent(m_display, m_surface, m_surface, m_context)) {
+        std::cerr << ">>> Failed to create OpenGL 3.3 core context" << std::endl;
+
+        return;
+    }
+
+    // initialize GLEW, a GLEW built for GLX reports a missing X display
+    // after loading the core entry points, which is harmless here
+    glewExperimental = GL_TRUE;
+    GLenum status = glewInit();
+    if (status != GLEW_OK
+        && status != GLEW_ERROR_NO_GLX_DISPLAY) {
+        std::cerr << ">>> Failed to initialize GLEW: "
+            << glewGetErrorString(status) << std::endl;
+
+        return;
+    }
+
+    m_valid = true;
+}
+
+EGLDisplay HeadlessContext::openDisplay() const {
+    // prefer Mesa's surfaceless platform (no X server or GPU device needed)
+    PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay
+        = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+            eglGetProcAddress("eglGetPlatformDisplayEXT"));
+    if (getPlatformDisplay) {
+        EGLDisplay display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA,
+            EGL_DEFAULT_DISPLAY,
+            NULL);
+        if (display != EGL_NO_DISPLAY)
+            return display;
+    }
+
+    // otherwise fall back on the default display
+    return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+}
\ No newline at end of file
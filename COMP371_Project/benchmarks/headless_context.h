@@ -0,0 +1,41 @@
+#ifndef HEADLESS_CONTEXT_H
+#define HEADLESS_CONTEXT_H
+
+// GLEW
+#include <gl/glew.h>
+
+// EGL
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+// C++ standard library headers
+#include <iostream>
+
+// offscreen OpenGL context (no window), used by benchmarks
+class HeadlessContext {
+public:
+    HeadlessContext() = delete;
+    HeadlessContext(GLuint width,
+        GLuint height) {
+        initialize(width, height);
+    }
+    HeadlessContext(const HeadlessContext& context) = delete;
+    HeadlessContext(HeadlessContext&& context) = delete;
+    HeadlessContext& operator=(HeadlessContext& context) = delete;
+    ~HeadlessContext();
+
+    // getters
+    bool isValid() const;
+
+private:
+    void initialize(GLuint width,
+        GLuint height);
+    EGLDisplay openDisplay() const;
+
+    EGLDisplay m_display{ EGL_NO_DISPLAY };
+    EGLSurface m_surface{ EGL_NO_SURFACE };
+    EGLContext m_context{ EGL_NO_CONTEXT };
+    bool m_valid{ false };
+};
+
+#endif // !HEADLESS_CONTEXT_H
\ No newline at end of file
@@ -68,6 +68,11 @@ GLuint Camera::getViewportHeight() const {
     return m_viewportHeight;
 }
 
+GLfloat Camera::getViewportAspectRatio() const {
+    // return current viewport aspect ratio
+    return m_viewportAspectRatio;
+}
+
 GLfloat Camera::getMouseX() const {
     // get current camera x
     return m_mouseX;
@@ -30,6 +30,7 @@ public:
     const glm::vec3& getUpVector() const;
     GLuint getViewportWidth() const;
     GLuint getViewportHeight() const;
+    GLfloat getViewportAspectRatio() const;
     GLfloat getMouseX() const;
     GLfloat getMouseY() const;
     GLfloat getYaw() const;
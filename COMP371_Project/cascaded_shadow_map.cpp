@@ -0,0 +1,248 @@
+#include "cascaded_shadow_map.h"
+
+GLuint CascadedShadowMap::getCascadeCount() const {
+    // return number of cascades
+    return m_cascadeCount;
+}
+
+GLuint CascadedShadowMap::getDepthTextureID() const {
+    // return depth texture id
+    return m_depthTextureID;
+}
+
+GLuint CascadedShadowMap::getFBOID(GLuint cascade) const {
+    // return FBO id of a cascade layer
+    return m_FBOs[cascade];
+}
+
+const glm::vec4& CascadedShadowMap::getSplits() const {
+    // return view depths where each cascade ends
+    return m_splits;
+}
+
+const std::vector<glm::mat4>& CascadedShadowMap::getTransforms() const {
+    // return light view-projection matrices of all cascades
+    return m_transforms;
+}
+
+GLuint CascadedShadowMap::getSize() const {
+    // return depth texture layer width and height
+    return m_size;
+}
+
+bool CascadedShadowMap::isValid() const {
+    // get whether the layers match the current cascades and casters
+    return m_valid;
+}
+
+void CascadedShadowMap::allocate() {
+    // allocate the layers at the current size, they are rendered again
+    if (m_allocated)
+        return;
+
+    initializeDepthTexture(m_size);
+    m_allocated = true;
+    m_valid = false;
+
+    // check the framebuffers for problems
+    bool complete{ true };
+    for (GLuint cascade{ 0 }; cascade != m_cascadeCount; ++cascade) {
+        GLState::bindFramebuffer(m_FBOs[cascade]);
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER)
+            != GL_FRAMEBUFFER_COMPLETE)
+            complete = false;
+    }
+    if (complete)
+        std::cout << "Cascaded shadow map framebuffer complete."
+        << std::endl << std::endl;
+    else
+        std::cout << ">>> Cascaded shadow map framebuffer incomplete."
+        << std::endl << std::endl;
+
+    // unbind framebuffer
+    GLState::bindFramebuffer(NULL);
+}
+
+void CascadedShadowMap::free() const {
+    // free resources
+    glDeleteFramebuffers(m_cascadeCount, m_FBOs);
+    glDeleteTextures(1, &m_depthTextureID);
+}
+
+void CascadedShadowMap::invalidate() {
+    // casters changed, render the layers again
+    m_valid = false;
+}
+
+void CascadedShadowMap::release() {
+    // drop the storage of the layers, the name and framebuffers are kept for
+    // the next allocation
+    if (!m_allocated)
+        return;
+
+    initializeDepthTexture(0);
+    m_allocated = false;
+}
+
+void CascadedShadowMap::resize(GLuint size) {
+    // reallocate the layers if allocated, framebuffers stay attached
+    if (size == m_size)
+        return;
+
+    m_size = size;
+    if (!m_allocated)
+        return;
+
+    initializeDepthTexture(m_size);
+    m_valid = false;
+}
+
+void CascadedShadowMap::update(const glm::mat4& viewMatrix,
+    GLfloat fov,
+    GLfloat aspectRatio,
+    const glm::vec3& lightDirection) {
+    // split view depths between logarithmic (even texel density) and
+    // uniform distributions
+    GLfloat planeNear{ CAMERA_PLANE_NEAR };
+    GLfloat planeFar{ glm::min(SHADOW_CASCADE_DISTANCE, CAMERA_PLANE_FAR) };
+    glm::vec4 splits{ planeFar };
+    for (GLuint i{ 1 }; i <= m_cascadeCount; ++i) {
+        GLfloat fraction{ static_cast<GLfloat>(i) / m_cascadeCount };
+        splits[i - 1] = SHADOW_CASCADE_SPLIT_LAMBDA
+            * planeNear * glm::pow(planeFar / planeNear, fraction)
+            + (1.0f - SHADOW_CASCADE_SPLIT_LAMBDA)
+            * (planeNear + (planeFar - planeNear) * fraction);
+    }
+
+    // light axes, the light looks down its direction
+    glm::vec3 direction{ glm::normalize(lightDirection) };
+    glm::vec3 up{ glm::abs(direction.y) > 0.99f ? AXIS_Z : AXIS_Y };
+    glm::mat4 lightRotation{ glm::lookAt(POSITION_ORIGIN, -direction, up) };
+    glm::mat4 inverseView{ glm::inverse(viewMatrix) };
+    GLfloat tanHalfFOV{ glm::tan(glm::radians(fov) / 2.0f) };
+
+    std::vector<glm::mat4> transforms(m_cascadeCount);
+    for (GLuint cascade{ 0 }; cascade != m_cascadeCount; ++cascade) {
+        // corners of the frustum slice in world space
+        GLfloat depths[]{ cascade == 0 ? planeNear : splits[cascade - 1],
+            splits[cascade] };
+        glm::vec3 corners[8];
+        glm::vec3 center{ 0.0f };
+        for (GLuint i{ 0 }; i != 8; ++i) {
+            GLfloat depth{ depths[i / 4] };
+            GLfloat y{ depth * tanHalfFOV * ((i & 1) ? 1.0f : -1.0f) };
+            GLfloat x{ depth * tanHalfFOV * aspectRatio * ((i & 2) ? 1.0f : -1.0f) };
+            corners[i] = glm::vec3(inverseView * glm::vec4(x, y, -depth, 1.0f));
+            center += corners[i] / 8.0f;
+        }
+
+        // bounding sphere, its radius does not change with camera rotation
+        // (rounded so that precision errors do not resize the cascade)
+        GLfloat radius{ 0.0f };
+        for (GLuint i{ 0 }; i != 8; ++i)
+            radius = glm::max(radius, glm::length(corners[i] - center));
+        radius = glm::ceil(radius * 16.0f) / 16.0f;
+
+        // snap the center to whole texels across the light axes
+        GLfloat texelsPerUnit{ m_size / (2.0f * radius) };
+        glm::vec4 snapped{ lightRotation * glm::vec4(center, 1.0f) };
+        snapped.x = glm::floor(snapped.x * texelsPerUnit) / texelsPerUnit;
+        snapped.y = glm::floor(snapped.y * texelsPerUnit) / texelsPerUnit;
+        center = glm::vec3(glm::inverse(lightRotation) * snapped);
+
+        // orthographic projection around the sphere, pulled back towards the
+        // light so that casters outside the slice still write depth
+        glm::vec3 eye{ center
+            + direction * (radius + SHADOW_CASCADE_CASTER_DISTANCE) };
+        transforms[cascade] = glm::ortho(-radius,
+            radius,
+            -radius,
+            radius,
+            0.0f,
+            2.0f * radius + SHADOW_CASCADE_CASTER_DISTANCE)
+            * glm::lookAt(eye, center, up);
+    }
+
+    // the layers hold for one set of cascades
+    if (transforms != m_transforms) {
+        m_transforms = transforms;
+        m_valid = false;
+    }
+    m_splits = splits;
+}
+
+void CascadedShadowMap::validate() {
+    // layers rendered
+    m_valid = true;
+}
+
+void CascadedShadowMap::initialize() {
+    // cascade count from scene configuration
+    m_cascadeCount = Config::get().getShadowCascades();
+
+    // depth texture at the configured size, storage is allocated when the
+    // shadow mode needs it
+    m_size = Config::get().getShadowSize();
+    glGenTextures(1, &m_depthTextureID);
+    initializeDepthTexture(0);
+
+    // attach each layer as depth attachment of its own framebuffer,
+    // framebuffers will not use a color buffer
+    glGenFramebuffers(m_cascadeCount, m_FBOs);
+    for (GLuint cascade{ 0 }; cascade != m_cascadeCount; ++cascade) {
+        GLState::bindFramebuffer(m_FBOs[cascade]);
+        glFramebufferTextureLayer(GL_FRAMEBUFFER,
+            GL_DEPTH_ATTACHMENT,
+            m_depthTextureID,
+            0,
+            cascade);
+        glDrawBuffer(GL_NONE);
+        glReadBuffer(GL_NONE);
+    }
+
+    // unbind framebuffer
+    GLState::bindFramebuffer(NULL);
+}
+
+void CascadedShadowMap::initializeDepthTexture(GLuint size) {
+    // allocate one depth layer per cascade
+    GLState::bindTexture(GL_TEXTURE_2D_ARRAY, m_depthTextureID);
+    glTexImage3D(GL_TEXTURE_2D_ARRAY,
+        0,
+        GL_DEPTH_COMPONENT24,
+        size,
+        size,
+        m_cascadeCount,
+        0,
+        GL_DEPTH_COMPONENT,
+        GL_FLOAT,
+        NULL);
+
+    // set texture wrapping parameters, beyond the cascade nothing is shadowed
+    glTexParameteri(GL_TEXTURE_2D_ARRAY,
+        GL_TEXTURE_WRAP_S,
+        GL_CLAMP_TO_BORDER);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY,
+        GL_TEXTURE_WRAP_T,
+        GL_CLAMP_TO_BORDER);
+    glTexParameterfv(GL_TEXTURE_2D_ARRAY,
+        GL_TEXTURE_BORDER_COLOR,
+        SHADOW_BORDER_COLOR);
+
+    // compare against the depth texture when sampled, linear filtering then
+    // blends the results of the four nearest texels
+    glTexParameteri(GL_TEXTURE_2D_ARRAY,
+        GL_TEXTURE_COMPARE_MODE,
+        GL_COMPARE_REF_TO_TEXTURE);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY,
+        GL_TEXTURE_COMPARE_FUNC,
+        GL_LEQUAL);
+
+    // set texture filtering parameters
+    glTexParameteri(GL_TEXTURE_2D_ARRAY,
+        GL_TEXTURE_MIN_FILTER,
+        GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY,
+        GL_TEXTURE_MAG_FILTER,
+        GL_LINEAR);
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+#ifndef CASCADED_SHADOW_MAP_H
+#define CASCADED_SHADOW_MAP_H
+
+// project headers
+#include "config.h"
+#include "constants.h"
+#include "gl_state.h"
+
+// GLEW
+#include <gl/glew.h>
+
+// GLM
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+// C++ standard library headers
+#include <iostream>
+#include <vector>
+
+// depth texture of a directional light: the camera frustum (up to the shadow
+// distance) is split into slices, each covered by an orthographic cascade
+// rendered to its own layer of a 2D array texture, so that texels are spent
+// near the camera; cascades are fitted to bounding spheres snapped to whole
+// texels, so they only move when the camera translates; texture storage only
+// exists while the directional shadow mode is active
+class CascadedShadowMap {
+public:
+    CascadedShadowMap() {
+        initialize();
+    }
+
+    // getters
+    GLuint getCascadeCount() const;
+    GLuint getDepthTextureID() const;
+    GLuint getFBOID(GLuint cascade) const;
+    const glm::vec4& getSplits() const;
+    const std::vector<glm::mat4>& getTransforms() const;
+    GLuint getSize() const;
+    bool isValid() const;
+
+    // utilities
+    void allocate();
+    void free() const;
+    void invalidate();
+    void release();
+    void resize(GLuint size);
+    void update(const glm::mat4& viewMatrix,
+        GLfloat fov,
+        GLfloat aspectRatio,
+        const glm::vec3& lightDirection);
+    void validate();
+
+private:
+    void initialize();
+    void initializeDepthTexture(GLuint size);
+
+    GLuint m_cascadeCount;
+    GLuint m_depthTextureID;
+    GLuint m_size;
+    GLuint m_FBOs[SHADOW_CASCADES_MAX];
+    std::vector<glm::mat4> m_transforms;
+    glm::vec4 m_splits;
+    bool m_valid{ false };
+    bool m_allocated{ false };
+};
+
+#endif // !CASCADED_SHADOW_MAP_H
\ No newline at end of file
@@ -2,6 +2,9 @@
 
 std::vector<Model*> Collision::s_collisions;
 
+// colliding models found by the last detection pass
+GLuint Collision::s_collidingCount = 0;
+
 void Collision::addToCollisionVector(Model* model) {
     // check whether model is already colliding
     std::vector<Model*>::iterator it = std::find(
@@ -14,8 +17,24 @@ void Collision::addToCollisionVector(Model* model) {
         s_collisions.push_back(model);
 }
 
+void Collision::clear() {
+    // forget all colliding models
+    s_collisions.clear();
+    s_collidingCount = 0;
+}
+
+GLuint Collision::getCollidingCount() {
+    // get number of colliding models found by the last detection pass
+    return s_collidingCount;
+}
+
 const std::vector<Model*> Collision::detectCollisions(
     const std::vector<Model*>& models) {
+    PROFILE_ZONE("Collision::detectCollisions");
+
+    // colliding models are counted anew on every pass
+    s_collidingCount = 0;
+
     // check for collision between pairs of models
     for (GLuint i{ 0 }; i != models.size(); ++i) {
         glm::vec3 iPosition = models.at(i)->getPosition();
@@ -48,6 +67,7 @@ const std::vector<Model*> Collision::detectCollisions(
         // update collision vector accordingly
         if (colliding) {
             addToCollisionVector(models.at(i));
+            ++s_collidingCount;
         }
         else
             removeFromCollisionVector(models.at(i));
@@ -76,4 +96,28 @@ void Collision::removeFromCollisionVector(Model* model) {
     // if so, remove it
     if (it != s_collisions.end())
         s_collisions.erase(it);
+}
+
+bool Collision::isSphereInFrustum(const glm::mat4& viewProjection,
+    const glm::vec3& center,
+    GLfloat radius) {
+    // frustum planes are sums and differences of the matrix rows, the
+    // sphere is outside if it lies entirely behind any of them
+    glm::mat4 rows{ glm::transpose(viewProjection) };
+    glm::vec4 planes[6]{
+        rows[3] + rows[0],
+        rows[3] - rows[0],
+        rows[3] + rows[1],
+        rows[3] - rows[1],
+        rows[3] + rows[2],
+        rows[3] - rows[2]
+    };
+    for (GLuint i{ 0 }; i != 6; ++i) {
+        GLfloat distance{ (glm::dot(glm::vec3(planes[i]), center) + planes[i].w)
+            / glm::length(glm::vec3(planes[i])) };
+        if (distance < -radius)
+            return false;
+    }
+
+    return true;
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define COLLISION_H
 
 #include "model.h"
+#include "profiler.h"
 
 class Collision {
 public:
@@ -10,12 +11,20 @@ public:
     Collision(Collision&& collision) = delete;
     Collision& operator=(Collision& collision) = delete;
 
+    // getters
+    static GLuint getCollidingCount();
+
     // collision detection
+    static void clear();
     static const std::vector<Model*> detectCollisions(
         const std::vector<Model*>& models);
+    static bool isSphereInFrustum(const glm::mat4& viewProjection,
+        const glm::vec3& center,
+        GLfloat radius);
 
 private:
     static std::vector<Model*> s_collisions;
+    static GLuint s_collidingCount;
 
     // collision handling
     static void addToCollisionVector(Model* model);
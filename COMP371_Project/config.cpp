@@ -0,0 +1,199 @@
+#include "config.h"
+
+// C++ standard library headers
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+Config& Config::get() {
+    // create or return singleton instance
+    static Config s_instance;
+
+    return s_instance;
+}
+
+GLuint Config::getGrassCount() const {
+    // get number of grass blades per grass version
+    return m_grassCount;
+}
+
+GLuint Config::getParticleCount() const {
+    // get number of rain particles, proportional to the troop unless set
+    if (m_particleCountSet)
+        return m_particleCount;
+
+    return m_troopCount * PARTICLE_COUNT_PER_TROOP;
+}
+
+GLuint Config::getPathCount() const {
+    // get number of steps in each horse path
+    return m_pathCount;
+}
+
+GLuint Config::getShadowCascades() const {
+    // get number of directional shadow cascades
+    return m_shadowCascades;
+}
+
+GLuint Config::getShadowGridSamples() const {
+    // get initial shadow grid sample count
+    return m_shadowGridSamples;
+}
+
+GLuint Config::getShadowSize() const {
+    // get shadow map face width and height (cubemap faces are square)
+    return m_shadowSize;
+}
+
+GLuint Config::getTargetFPS() const {
+    // get frame rate adaptive shadow quality aims for (0 when disabled)
+    return m_targetFPS;
+}
+
+GLuint Config::getTroopCount() const {
+    // get number of horses
+    return m_troopCount;
+}
+
+GLuint* Config::getOption(const std::string& key,
+    GLuint& minimum,
+    GLuint& maximum) {
+    // get the value of an option and its range, nullptr for unknown keys
+    minimum = 0;
+    maximum = 0x7fffffff;
+    if (key == "troops") {
+        minimum = 1;
+        return &m_troopCount;
+    }
+    if (key == "grass")
+        return &m_grassCount;
+    if (key == "particles")
+        return &m_particleCount;
+    if (key == "paths") {
+        minimum = 1;
+        return &m_pathCount;
+    }
+    if (key == "shadow-samples") {
+        minimum = SHADOW_GRID_SAMPLES_MIN;
+        maximum = SHADOW_GRID_SAMPLES_MAX;
+        return &m_shadowGridSamples;
+    }
+    if (key == "shadow-cascades") {
+        minimum = SHADOW_CASCADES_MIN;
+        maximum = SHADOW_CASCADES_MAX;
+        return &m_shadowCascades;
+    }
+    if (key == "shadow-size") {
+        minimum = 1;
+        return &m_shadowSize;
+    }
+    if (key == "target-fps")
+        return &m_targetFPS;
+
+    return nullptr;
+}
+
+bool Config::isOption(const std::string& key) {
+    // get whether the key names a scene option
+    GLuint minimum;
+    GLuint maximum;
+
+    return getOption(key, minimum, maximum) != nullptr;
+}
+
+bool Config::load(int& argc, char* argv[]) {
+    // read scene options (--troops N, --config PATH, ...) and remove them
+    // from the argument list, other arguments are left for the caller
+    bool valid{ true };
+    int kept{ 1 };
+    for (int i{ 1 }; i < argc; ++i) {
+        std::string arg{ argv[i] };
+        std::string key{ arg.size() > 2 && arg.compare(0, 2, "--") == 0
+            ? arg.substr(2)
+            : "" };
+
+        if (key == "config" && i + 1 < argc)
+            valid = loadFile(argv[++i]) && valid;
+        else if (!key.empty()
+            && key != "config"
+            && i + 1 < argc
+            && isOption(key)) {
+            // a rejected value is consumed too, and fatal as in a file
+            valid = set(key, argv[++i]) && valid;
+        }
+        else
+            argv[kept++] = argv[i];
+    }
+    argc = kept;
+
+    return valid;
+}
+
+bool Config::loadFile(const std::string& path) {
+    // read "key = value" lines, # starts a comment
+    std::ifstream file(path);
+    if (!file) {
+        std::cerr << ">>> Failed to open config file " << path
+            << std::endl;
+
+        return false;
+    }
+
+    bool valid{ true };
+    std::string line;
+    GLuint lineNumber{ 0 };
+    while (std::getline(file, line)) {
+        ++lineNumber;
+
+        // strip comments and treat the separator as whitespace
+        std::string::size_type comment = line.find('#');
+        if (comment != std::string::npos)
+            line.erase(comment);
+        std::string::size_type separator = line.find('=');
+        if (separator != std::string::npos)
+            line.at(separator) = ' ';
+
+        std::istringstream ss(line);
+        std::string key;
+        std::string value;
+        std::string trailing;
+        if (!(ss >> key))
+            continue;
+        if (!(ss >> value) || (ss >> trailing) || !set(key, value)) {
+            std::cerr << ">>> Invalid config entry at " << path << ":"
+                << lineNumber << std::endl;
+            valid = false;
+        }
+    }
+
+    return valid;
+}
+
+bool Config::set(const std::string& key,
+    const std::string& value) {
+    // look up the option and its range
+    GLuint minimum;
+    GLuint maximum;
+    GLuint* target{ getOption(key, minimum, maximum) };
+    if (!target)
+        return false;
+
+    // parse value as an integer within range (the scene needs at least one
+    // horse and one path step, shadow map faces cannot be empty, and the
+    // sample and cascade counts are bounded by the shaders)
+    std::istringstream ss(value);
+    long long number{ -1 };
+    char trailing;
+    if (!(ss >> number) || (ss >> trailing)
+        || number < minimum || number > maximum) {
+        std::cerr << ">>> Invalid value for " << key << ": " << value
+            << std::endl;
+
+        return false;
+    }
+    *target = static_cast<GLuint>(number);
+    if (key == "particles")
+        m_particleCountSet = true;
+
+    return true;
+}
@@ -0,0 +1,61 @@
+#ifndef CONFIG_H
+#define CONFIG_H
+
+// project headers
+#include "constants.h"
+
+// GLEW
+#include <gl/glew.h>
+
+// C++ standard library headers
+#include <string>
+
+// singleton, scene scale parameters read from the command line or a config
+// file at startup (must be loaded before the renderer is first used)
+class Config {
+public:
+    Config(const Config& config) = delete;
+    Config(Config&& config) = delete;
+    Config& operator=(Config& config) = delete;
+    static Config& get();
+
+    // getters
+    GLuint getGrassCount() const;
+    GLuint getParticleCount() const;
+    GLuint getPathCount() const;
+    GLuint getShadowCascades() const;
+    GLuint getShadowGridSamples() const;
+    GLuint getShadowSize() const;
+    GLuint getTargetFPS() const;
+    GLuint getTroopCount() const;
+
+    // utilities
+    bool load(int& argc, char* argv[]);
+    bool loadFile(const std::string& path);
+
+private:
+    Config() = default;
+
+    // getters
+    GLuint* getOption(const std::string& key,
+        GLuint& minimum,
+        GLuint& maximum);
+    bool isOption(const std::string& key);
+
+    // utilities
+    bool set(const std::string& key,
+        const std::string& value);
+
+    static Config& s_instance;
+    GLuint m_grassCount{ GRASS_COUNT_DEFAULT };
+    GLuint m_particleCount{ 0 };
+    GLuint m_pathCount{ PATH_COUNT_DEFAULT };
+    GLuint m_shadowCascades{ SHADOW_CASCADES_DEFAULT };
+    GLuint m_shadowGridSamples{ SHADOW_GRID_SAMPLES_DEFAULT };
+    GLuint m_shadowSize{ SHADOW_DEPTH_TEXTURE_SIZE_DEFAULT };
+    GLuint m_targetFPS{ SHADOW_BUDGET_FPS_DEFAULT };
+    GLuint m_troopCount{ TROOP_COUNT_DEFAULT };
+    bool m_particleCountSet{ false };
+};
+
+#endif // !CONFIG_H
\ No newline at end of file
@@ -1,6 +1,10 @@
 #ifndef CONSTANTS_H
 #define CONSTANTS_H
 
+// project headers
+#include "gl_counters.h"
+#include "uniform.h"
+
 // GLEW
 #include <gl/glew.h>
 
@@ -26,7 +30,7 @@ const glm::vec3 POSITION_ORIGIN{ glm::vec3(0.0f, 0.0f, 0.0f) };
 const GLfloat POSITION_MAX{ 50.0f };
 const GLfloat POSITION_MIN{ -50.0f };
 const GLuint GRID_SIZE{ static_cast<GLuint>(POSITION_MAX - POSITION_MIN) };
-const GLuint TROOP_COUNT{ 40 };
+const GLuint TROOP_COUNT_DEFAULT{ 40 };
 
 // camera initialization constants
 const glm::vec3 CAMERA_POSITION{ glm::vec3(0.0f, 15.0f, 0.0f) };
@@ -52,65 +56,142 @@ const std::string DATA_VERTICES_GRID;
 const std::string DATA_VERTICES_GROUND;
 const std::string DATA_VERTICES_MODEL;
 
+// raw vertex layout: interleaved position, normal and texture coordinates
+// (or positions only), built into a position stream and a packed attribute
+// stream (10-10-10-2 normal, half texture coordinates)
+const GLuint VERTEX_COMPONENTS{ 8 };
+const GLuint VERTEX_POSITION_COMPONENTS{ 3 };
+const GLsizei VERTEX_ATTRIBUTE_STRIDE{ 2 * sizeof(GLuint) };
+
+// mesh cache optimization: simulated post-transform cache size and vertex
+// score weights (Forsyth)
+const GLuint MESH_CACHE_SIZE{ 32 };
+const GLfloat MESH_CACHE_DECAY_POWER{ 1.5f };
+const GLfloat MESH_LAST_TRIANGLE_SCORE{ 0.75f };
+const GLfloat MESH_VALENCE_BOOST_SCALE{ 2.0f };
+const GLfloat MESH_VALENCE_BOOST_POWER{ 0.5f };
+
 // shader attribute constants
 const std::string ATTRIBUTE_POSITION{ "i_position" };
 const std::string ATTRIBUTE_NORMAL{ "i_normal" };
 const std::string ATTRIBUTE_TEXTURE{ "i_texture" };
 const std::string ATTRIBUTE_OFFSET{ "i_offset" };
+const std::string ATTRIBUTE_COLOR{ "i_color" };
+
+// shader attribute locations of entity meshes, fixed so that vertex array
+// objects are specified once for every program: position, normal, texture
+// coordinates, per-instance model matrix (four locations) and color
+const GLuint ATTRIBUTE_LOCATION_POSITION{ 0 };
+const GLuint ATTRIBUTE_LOCATION_NORMAL{ 1 };
+const GLuint ATTRIBUTE_LOCATION_TEXTURE{ 2 };
+const GLuint ATTRIBUTE_LOCATION_INSTANCE_MODEL{ 3 };
+const GLuint ATTRIBUTE_LOCATION_INSTANCE_COLOR{ 7 };
 
 // shader uniforms: general
-const std::string UNIFORM_COLOR{ "u_color" };
-const std::string UNIFORM_MATRIX_MODEL{ "u_modelMat" };
-const std::string UNIFORM_MATRIX_VIEW{ "u_viewMat" };
-const std::string UNIFORM_MATRIX_PROJECTION{ "u_projectionMat" };
+constexpr Uniform<glm::vec4> UNIFORM_COLOR{ "u_color" };
+constexpr Uniform<glm::mat4> UNIFORM_MATRIX_MODEL{ "u_modelMat" };
+constexpr Uniform<bool> UNIFORM_INSTANCED{ "u_instanced" };
+constexpr Uniform<GLint> UNIFORM_DRAW_INDEX{ "u_drawIndex" };
 
 // shader uniforms: material properties
-const std::string UNIFORM_MATERIAL_DIFFUSE{ "u_material.diffuse" };
-const std::string UNIFORM_MATERIAL_SPECULAR{ "u_material.specular" };
-const std::string UNIFORM_MATERIAL_SHININESS{ "u_material.shininess" };
-
-// shader uniforms: light and light-related properties
-const std::string UNIFORM_CAMERA_POSITION{ "u_cameraPosition" };
-const std::string UNIFORM_LIGHT_COLOR{ "u_light.color" };
-const std::string UNIFORM_LIGHT_AMBIENT{ "u_light.ambient" };
-const std::string UNIFORM_LIGHT_DIFFUSE{ "u_light.diffuse" };
-const std::string UNIFORM_LIGHT_SPECULAR{ "u_light.specular" };
-const std::string UNIFORM_LIGHT_POSITION{ "u_light.position" };
-const std::string UNIFORM_LIGHT_KC{ "u_light.kc" };
-const std::string UNIFORM_LIGHT_KL{ "u_light.kl" };
-const std::string UNIFORM_LIGHT_KQ{ "u_light.kq" };
-const std::string UNIFORM_LIGHT_PLANES{ "u_light.planeNearFar" };
-const std::string UNIFORM_RIM_LIGHT_COLOR{ "u_rim.color" };
-const std::string UNIFORM_RIM_LIGHT_MAX{ "u_rim.max" };
-const std::string UNIFORM_RIM_LIGHT_MIN{ "u_rim.min" };
+constexpr Uniform<GLint> UNIFORM_MATERIAL_DIFFUSE{ "u_material.diffuse" };
+constexpr Uniform<GLint> UNIFORM_MATERIAL_SPECULAR{ "u_material.specular" };
+constexpr Uniform<GLfloat> UNIFORM_MATERIAL_SHININESS{ "u_material.shininess" };
+
+// shader uniform blocks: camera (view and projection matrices, camera
+// position and axes) and lighting (light, fog and rim lighting)
+const std::string UNIFORM_BLOCK_CAMERA{ "Camera" };
+const std::string UNIFORM_BLOCK_LIGHTING{ "Lighting" };
+const GLuint UNIFORM_BLOCK_BINDING_CAMERA{ 0 };
+const GLuint UNIFORM_BLOCK_BINDING_LIGHTING{ 1 };
+
+// shader uniform block: model matrix and color of each draw that is not
+// instanced, the array size must match the Draws block in the shaders
+const std::string UNIFORM_BLOCK_DRAWS{ "Draws" };
+const GLuint UNIFORM_BLOCK_BINDING_DRAWS{ 2 };
+const GLuint DRAW_DATA_CAPACITY{ 16 };
+
+// shader uniforms: light properties outside of uniform blocks
+constexpr Uniform<glm::vec3> UNIFORM_LIGHT_POSITION{ "u_light.position" };
+constexpr Uniform<glm::vec2> UNIFORM_LIGHT_PLANES{ "u_light.planeNearFar" };
 
 // shader uniforms: shadows
-const std::string UNIFORM_SHADOWS_ENABLED{ "u_shadowsEnabled" };
-const std::string UNIFORM_SHADOW_BIAS_MIN{ "u_biasMin" };
-const std::string UNIFORM_SHADOW_BIAS_MAX{ "u_biasMax" };
-const std::string UNIFORM_SHADOW_DEPTH_TEXTURE{ "u_depthTexture" };
-const std::string UNIFORM_SHADOW_TRANSFORMS{ "u_shadowTransforms" };
-const std::string UNIFORM_SHADOW_GRID_SAMPLES{ "u_gridSamples" };
-const std::string UNIFORM_SHADOW_GRID_OFFSET{ "u_gridOffset" };
-const std::string UNIFORM_SHADOW_GRID_FACTOR{ "u_gridFactor" };
+constexpr Uniform<bool> UNIFORM_SHADOWS_ENABLED{ "u_shadowsEnabled" };
+constexpr Uniform<GLfloat> UNIFORM_SHADOW_BIAS_MIN{ "u_biasMin" };
+constexpr Uniform<GLfloat> UNIFORM_SHADOW_BIAS_MAX{ "u_biasMax" };
+constexpr Uniform<GLint> UNIFORM_SHADOW_DEPTH_TEXTURE{ "u_depthTexture" };
+constexpr Uniform<glm::mat4> UNIFORM_SHADOW_TRANSFORM{ "u_shadowTransform" };
+constexpr Uniform<GLint> UNIFORM_SHADOW_GRID_SAMPLES{ "u_gridSamples" };
+constexpr Uniform<GLfloat> UNIFORM_SHADOW_GRID_OFFSET{ "u_gridOffset" };
+constexpr Uniform<GLfloat> UNIFORM_SHADOW_GRID_FACTOR{ "u_gridFactor" };
+constexpr Uniform<bool> UNIFORM_SHADOW_DIRECTIONAL{ "u_directional" };
+constexpr Uniform<glm::vec3> UNIFORM_SHADOW_LIGHT_DIRECTION{ "u_lightDirection" };
+constexpr Uniform<GLint> UNIFORM_SHADOW_CASCADE_COUNT{ "u_cascadeCount" };
+constexpr Uniform<glm::vec4> UNIFORM_SHADOW_CASCADE_SPLITS{ "u_cascadeSplits" };
+constexpr Uniform<glm::mat4> UNIFORM_SHADOW_CASCADE_TRANSFORMS{ "u_cascadeTransforms" };
+constexpr Uniform<GLint> UNIFORM_SHADOW_CASCADE_TEXTURE{ "u_cascadeTexture" };
 
 // shader uniforms: textures
-const std::string UNIFORM_TEXTURES_ENABLED{ "u_texturesEnabled" };
-const std::string UNIFORM_SKYBOX_TEXTURE{ "u_skybox" };
+constexpr Uniform<bool> UNIFORM_TEXTURES_ENABLED{ "u_texturesEnabled" };
+constexpr Uniform<GLint> UNIFORM_SKYBOX_TEXTURE{ "u_skybox" };
 
 // shadow uniforms: fog
-const std::string UNIFORM_FOG_COLOR{ "u_fog.color" };
-const std::string UNIFORM_FOG_DENSITY{ "u_fog.density" };
-const std::string UNIFORM_FOG_ENABLED{ "u_fogEnabled" };
+constexpr Uniform<glm::vec4> UNIFORM_SKYBOX_FOG_COLOR{ "u_skyboxFog.color" };
+constexpr Uniform<GLfloat> UNIFORM_SKYBOX_FOG_DENSITY{ "u_skyboxFog.density" };
 
 // shadow uniforms: grass
-const std::string UNIFORM_WIND_TIME{ "u_time" };
-const std::string UNIFORM_WIND_DIRECTION{ "u_windDirection" };
-const std::string UNIFORM_WIND_STRENGTH{ "u_windStrength" };
-
-// shadow uniforms: particles
-const std::string UNIFORM_CAMERA_RIGHT{ "u_cameraRight" };
-const std::string UNIFORM_CAMERA_UP{ "u_cameraUp" };
+constexpr Uniform<GLfloat> UNIFORM_WIND_TIME{ "u_time" };
+constexpr Uniform<glm::vec3> UNIFORM_WIND_DIRECTION{ "u_windDirection" };
+constexpr Uniform<GLfloat> UNIFORM_WIND_STRENGTH{ "u_windStrength" };
+
+// shadow uniforms: overdraw
+constexpr Uniform<bool> UNIFORM_OVERDRAW_ENABLED{ "u_overdrawEnabled" };
+constexpr Uniform<GLfloat> UNIFORM_OVERDRAW_MAX{ "u_overdrawMax" };
+constexpr Uniform<GLint> UNIFORM_OVERDRAW_TEXTURE{ "u_overdrawTexture" };
+
+// shadow uniforms: hud
+constexpr Uniform<GLint> UNIFORM_HUD_FONT{ "u_font" };
+constexpr Uniform<glm::vec2> UNIFORM_HUD_VIEWPORT{ "u_viewport" };
+
+// every uniform handle, linked programs must not declare uniforms (other
+// than samplers left on texture unit 0) without one, or of another type
+constexpr UniformHandle UNIFORM_HANDLES[]{
+    UNIFORM_COLOR,
+    UNIFORM_MATRIX_MODEL,
+    UNIFORM_INSTANCED,
+    UNIFORM_DRAW_INDEX,
+    UNIFORM_MATERIAL_DIFFUSE,
+    UNIFORM_MATERIAL_SPECULAR,
+    UNIFORM_MATERIAL_SHININESS,
+    UNIFORM_LIGHT_POSITION,
+    UNIFORM_LIGHT_PLANES,
+    UNIFORM_SHADOWS_ENABLED,
+    UNIFORM_SHADOW_BIAS_MIN,
+    UNIFORM_SHADOW_BIAS_MAX,
+    UNIFORM_SHADOW_DEPTH_TEXTURE,
+    UNIFORM_SHADOW_TRANSFORM,
+    UNIFORM_SHADOW_GRID_SAMPLES,
+    UNIFORM_SHADOW_GRID_OFFSET,
+    UNIFORM_SHADOW_GRID_FACTOR,
+    UNIFORM_SHADOW_DIRECTIONAL,
+    UNIFORM_SHADOW_LIGHT_DIRECTION,
+    UNIFORM_SHADOW_CASCADE_COUNT,
+    UNIFORM_SHADOW_CASCADE_SPLITS,
+    UNIFORM_SHADOW_CASCADE_TRANSFORMS,
+    UNIFORM_SHADOW_CASCADE_TEXTURE,
+    UNIFORM_TEXTURES_ENABLED,
+    UNIFORM_SKYBOX_TEXTURE,
+    UNIFORM_SKYBOX_FOG_COLOR,
+    UNIFORM_SKYBOX_FOG_DENSITY,
+    UNIFORM_WIND_TIME,
+    UNIFORM_WIND_DIRECTION,
+    UNIFORM_WIND_STRENGTH,
+    UNIFORM_OVERDRAW_ENABLED,
+    UNIFORM_OVERDRAW_MAX,
+    UNIFORM_OVERDRAW_TEXTURE,
+    UNIFORM_HUD_FONT,
+    UNIFORM_HUD_VIEWPORT
+};
 
 // shader file paths
 const std::string PATH_VERTEX_RAIN{ "shaders/rain/vertex.shdr" };
@@ -122,10 +203,14 @@ const std::string PATH_FRAGMENT_FRAME{ "shaders/frame/fragment.shdr" };
 const std::string PATH_VERTEX_GRASS{ "shaders/grass/vertex.shdr" };
 const std::string PATH_FRAGMENT_GRASS{ "shaders/grass/fragment.shdr" };
 const std::string PATH_VERTEX_SHADOW{ "shaders/shadow/vertex.shdr" };
-const std::string PATH_GEOMETRY_SHADOW{ "shaders/shadow/geometry.shdr" };
 const std::string PATH_FRAGMENT_SHADOW{ "shaders/shadow/fragment.shdr" };
+const std::string PATH_FRAGMENT_SHADOW_CASCADE{ "shaders/shadow/cascade/fragment.shdr" };
 const std::string PATH_VERTEX_SHADOW_QUAD{ "shaders/shadow/quad/vertex.shdr" };
 const std::string PATH_FRAGMENT_SHADOW_QUAD{ "shaders/shadow/quad/fragment.shdr" };
+const std::string PATH_VERTEX_HUD{ "shaders/hud/vertex.shdr" };
+const std::string PATH_FRAGMENT_HUD{ "shaders/hud/fragment.shdr" };
+const std::string PATH_VERTEX_OVERDRAW{ "shaders/overdraw/vertex.shdr" };
+const std::string PATH_FRAGMENT_OVERDRAW{ "shaders/overdraw/fragment.shdr" };
 const std::string PATH_VERTEX_SKYBOX{ "shaders/skybox/vertex.shdr" };
 const std::string PATH_FRAGMENT_SKYBOX{ "shaders/skybox/fragment.shdr" };
 
@@ -151,10 +236,29 @@ const GLfloat MATERIAL_SHININESS_GRASS{ 8.0f };
 const GLfloat MATERIAL_SHININESS_GROUND{ 0.0f };
 const GLfloat MATERIAL_SHININESS_HORSE{ 8.0f };
 
+// material indices, in creation order
+const GLuint MATERIAL_INDEX_GROUND{ 0 };
+const GLuint MATERIAL_INDEX_GRASS_0{ 1 };
+const GLuint MATERIAL_INDEX_GRASS_1{ 2 };
+const GLuint MATERIAL_INDEX_RAIN{ 3 };
+const GLuint MATERIAL_INDEX_HORSE{ 4 };
+const GLuint MATERIAL_INDEX_NONE{ 0xFF };
+
 // rendering constants
 const GLfloat RENDERING_LINE_WIDTH{ 2.0f };
 const GLfloat RENDERING_POINT_SIZE{ 3.0f };
 
+// render queue sort key fields (bit offsets and widths), from most to least
+// significant: pass, layer, then program, depth, material and vertex array
+// for solid items, or depth (far first), program, material and vertex
+// array for blended items
+const GLuint RENDER_QUEUE_BITS_PASS{ 2 };
+const GLuint RENDER_QUEUE_BITS_LAYER{ 2 };
+const GLuint RENDER_QUEUE_BITS_PROGRAM{ 8 };
+const GLuint RENDER_QUEUE_BITS_DEPTH{ 16 };
+const GLuint RENDER_QUEUE_BITS_MATERIAL{ 8 };
+const GLuint RENDER_QUEUE_BITS_VAO{ 16 };
+
 // model transformations
 const GLint TRANSFORMATION_RANDOM_DISPLACEMENT{ static_cast<GLint>((POSITION_MAX - POSITION_MIN + 1) + POSITION_MIN) };
 const GLfloat TRANSFORMATION_INCREMENT_ROTATION{ 5.0f };
@@ -248,19 +352,19 @@ const GLfloat LIGHT_RIM_MIN{ 0.6f };
 const GLuint TEXTURE_INDEX_DIFFUSE{ 0 };
 const GLuint TEXTURE_INDEX_SPECULAR{ 1 };
 const GLuint TEXTURE_INDEX_DEPTH_MAP{ 2 };
+const GLuint TEXTURE_INDEX_CASCADE_MAP{ 3 };
 const GLuint TEXTURE_INDEX_SKYBOX{ 0 };
 const GLenum TEXTURE_UNIT_DIFFUSE{ GL_TEXTURE0 };
 const GLenum TEXTURE_UNIT_SPECULAR{ GL_TEXTURE1 };
 const GLenum TEXTURE_UNIT_DEPTH_MAP{ GL_TEXTURE2 };
+const GLenum TEXTURE_UNIT_CASCADE_MAP{ GL_TEXTURE3 };
 const GLenum TEXTURE_UNIT_SKYBOX{ GL_TEXTURE0 };
 
 // shadow-related constants
-const GLuint SHADOW_GRID_SAMPLES{ 32 };
-const GLuint SHADOW_DEPTH_TEXTURE_WIDTH{ 1024 };
-const GLuint SHADOW_DEPTH_TEXTURE_HEIGHT{ 1024 };
-const GLfloat SHADOW_ASPECT_RATIO{
-    static_cast<GLfloat>(SHADOW_DEPTH_TEXTURE_WIDTH)
-    / SHADOW_DEPTH_TEXTURE_HEIGHT };
+const GLuint SHADOW_GRID_SAMPLES_DEFAULT{ 32 };
+const GLuint SHADOW_GRID_SAMPLES_MIN{ 1 };
+const GLuint SHADOW_GRID_SAMPLES_MAX{ 32 };
+const GLuint SHADOW_DEPTH_TEXTURE_SIZE_DEFAULT{ 1024 };
 const GLfloat SHADOW_PROJECTION_FOV{ 90.0f };
 const GLfloat SHADOW_BIAS_MAX{ 0.090f };
 const GLfloat SHADOW_BIAS_MIN{ 0.050f };
@@ -272,6 +376,42 @@ const GLfloat SHADOW_INCREMENT_GRID_OFFSET{ 0.1f };
 const GLuint SHADOW_INCREMENT_GRID_SAMPLES{ 2 };
 const GLfloat SHADOW_BORDER_COLOR[]{ 1.0f, 1.0f, 1.0f, 1.0f };
 
+// frames a model's entity matrices must stay unchanged before it is rendered
+// to the static shadow layer
+const GLuint SHADOW_STATIC_FRAMES{ 30 };
+
+// added to model collider radii when culling casters against cubemap faces,
+// colliders only reach the entity pivots
+const GLfloat SHADOW_CULL_MARGIN{ 2.0f };
+
+// cascaded shadow maps of the directional light: cascade count range, view
+// depth covered (fog hides the scene beyond it), weight of logarithmic over
+// uniform splits and distance casters can stand towards the light from a
+// cascade (the ground diagonal)
+const GLuint SHADOW_CASCADES_MIN{ 2 };
+const GLuint SHADOW_CASCADES_MAX{ 4 };
+const GLuint SHADOW_CASCADES_DEFAULT{ 3 };
+const GLfloat SHADOW_CASCADE_DISTANCE{ 100.0f };
+const GLfloat SHADOW_CASCADE_SPLIT_LAMBDA{ 0.75f };
+const GLfloat SHADOW_CASCADE_CASTER_DISTANCE{ glm::length(glm::vec2(POSITION_MAX - POSITION_MIN)) };
+
+// adaptive shadow quality: default frame rate target (0 disables it),
+// smoothing of the measured frame cost, fraction of the budget to stay under
+// before stepping up, frames over the budget before stepping down and under
+// it before stepping up (doubled up to a maximum after a failed step up), and
+// per level divisors of the configured depth texture size and sample count
+// and frames between shadow updates
+const GLuint SHADOW_BUDGET_FPS_DEFAULT{ 60 };
+const GLdouble SHADOW_BUDGET_SMOOTHING{ 0.1 };
+const GLdouble SHADOW_BUDGET_RECOVERY{ 0.75 };
+const GLuint SHADOW_BUDGET_FRAMES_DOWN{ 15 };
+const GLuint SHADOW_BUDGET_FRAMES_UP{ 120 };
+const GLuint SHADOW_BUDGET_FRAMES_UP_MAX{ 1920 };
+const GLuint SHADOW_BUDGET_LEVELS{ 5 };
+const GLuint SHADOW_BUDGET_SIZE_DIVISORS[]{ 1, 1, 2, 2, 4 };
+const GLuint SHADOW_BUDGET_SAMPLE_DIVISORS[]{ 1, 2, 2, 4, 8 };
+const GLuint SHADOW_BUDGET_UPDATE_INTERVALS[]{ 1, 1, 1, 2, 3 };
+
 // animation-related constants
 const GLfloat ANIMATION_SPEED{ 4.0f };
 const GLuint JOINT_HEAD{ 0 };
@@ -293,7 +433,7 @@ const GLfloat PATHING_DIRECTION_MAX{ 45.0f };
 const GLfloat PATHING_DISTANCE_MIN{ 1.0f };
 const GLfloat PATHING_DISTANCE_MAX{ 4.0f };
 const GLfloat PATHING_SPEED{ 2.0f };
-const GLuint PATH_COUNT{ 15 };
+const GLuint PATH_COUNT_DEFAULT{ 15 };
 
 // fog-related constants
 const glm::vec4 COLOR_CLEAR{ glm::vec4(0.90f, 0.94f, 0.98f, 1.0f) };
@@ -301,12 +441,83 @@ const glm::vec4 COLOR_FOG{ COLOR_CLEAR };
 const GLfloat FOG_DENSITY{ 0.025f };
 
 // grass-related constants
-const GLuint GRASS_COUNT{ 512 };
+const GLuint GRASS_COUNT_DEFAULT{ 512 };
 const glm::vec3 GRASS_SCALE_MAX{ glm::vec3(1.0f, 1.0f, 1.0f) };
 const glm::vec3 GRASS_SCALE_MIN{ glm::vec3(0.7f, 0.7f, 0.7f) };
 const GLfloat WIND_STRENGTH{ 0.75f };
 
 // particle-related constants
-const GLuint PARTICLE_COUNT{ TROOP_COUNT * 8 };
+const GLuint PARTICLE_COUNT_PER_TROOP{ 8 };
+
+// timing-related constants
+const std::string TIMING_STAGE_NAMES[]{
+    "first_pass",
+    "second_pass",
+    "skybox",
+    "ground",
+    "models",
+    "lights",
+    "frame",
+    "grass_0",
+    "grass_1",
+    "particles",
+    "shadow_debug",
+    "overdraw",
+    "hud" };
+const GLuint GPU_TIMER_LATENCY{ 4 };
+const GLuint GPU_TIMER_HISTORY{ 3600 };
+const std::string PATH_GPU_TIMINGS{ "gpu_timings.csv" };
+const std::string GL_COUNTER_NAMES[]{
+    "draw_calls",
+    "triangles",
+    "uniform_uploads",
+    "uniform_location_lookups",
+    "attrib_location_lookups",
+    "program_binds",
+    "vertex_array_binds",
+    "texture_binds",
+    "buffer_uploads",
+    "vertex_attrib_pointers",
+    "uploaded_bytes",
+    "state_cache_hits",
+    "state_cache_misses" };
+
+// GL state cache constants
+const GLuint GL_STATE_TEXTURE_UNITS{ 16 };
+const GLuint GL_STATE_UNKNOWN{ 0xFFFFFFFF };
+const GLuint PROFILER_CAPACITY{ 1 << 20 };
+
+// stream buffer constants
+const GLuint STREAM_BUFFER_FRAMES{ 3 };
+const GLsizeiptr STREAM_BUFFER_FRAME_SIZE{ 1 << 20 };
+const GLintptr STREAM_BUFFER_ALIGNMENT{ 16 };
+const GLuint64 STREAM_BUFFER_TIMEOUT{ 1000000 };
+
+// overdraw-related constants
+const GLfloat OVERDRAW_COUNT_MAX{ 8.0f };
+
+// hud-related constants
+const GLuint HUD_FONT_FIRST_CHARACTER{ 32 };
+const GLuint HUD_FONT_GLYPHS{ 64 };
+const GLuint HUD_FONT_WIDTH{ 5 };
+const GLuint HUD_FONT_HEIGHT{ 7 };
+const GLfloat HUD_SCALE{ 2.0f };
+const GLuint HUD_VERTEX_SIZE{ 8 };
+const GLfloat HUD_MARGIN{ 8.0f };
+const GLuint HUD_GRAPH_SAMPLES{ 240 };
+const GLfloat HUD_GRAPH_HEIGHT{ 80.0f };
+const GLdouble HUD_GRAPH_TIME_MAX{ 50.0 };
+const GLdouble HUD_FRAME_TIME_TARGET{ 1000.0 / 60.0 };
+const glm::vec4 HUD_COLOR_BACKGROUND{ glm::vec4(0.0f, 0.0f, 0.0f, 0.6f) };
+const glm::vec4 HUD_COLOR_TEXT{ glm::vec4(1.0f, 1.0f, 1.0f, 1.0f) };
+const glm::vec4 HUD_COLOR_GOOD{ glm::vec4(0.3f, 0.9f, 0.3f, 1.0f) };
+const glm::vec4 HUD_COLOR_SLOW{ glm::vec4(0.95f, 0.8f, 0.2f, 1.0f) };
+const glm::vec4 HUD_COLOR_HITCH{ glm::vec4(0.95f, 0.25f, 0.2f, 1.0f) };
+const glm::vec4 HUD_COLOR_GUIDE{ glm::vec4(1.0f, 1.0f, 1.0f, 0.35f) };
+
+// recording-related constants
+const char REPLAY_MAGIC[]{ 'R', 'P', 'L', 'Y' };
+const GLuint REPLAY_VERSION{ 1 };
+const std::string PATH_PROFILER_TRACE{ "profile_trace.json" };
 
 #endif // !CONSTANTS_H
\ No newline at end of file
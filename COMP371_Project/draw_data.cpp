@@ -0,0 +1,45 @@
+#include "draw_data.h"
+
+void DrawData::setDraw(Rendering::DrawSlot slot,
+    const glm::mat4& modelMatrix,
+    const glm::vec4& color) {
+    // set model matrix and color of a draw
+    m_draws[slot].modelMatrix = modelMatrix;
+    m_draws[slot].color = color;
+}
+
+void DrawData::free() const {
+    // free resources
+    glDeleteBuffers(1, &m_drawsUBO);
+}
+
+void DrawData::upload() const {
+    // write the frame's draws at once, orphaning the storage the previous
+    // frame's draws may still be reading
+    GLState::bindBuffer(GL_UNIFORM_BUFFER, m_drawsUBO);
+    glBufferData(GL_UNIFORM_BUFFER,
+        sizeof(m_draws),
+        m_draws,
+        GL_STREAM_DRAW);
+    GLState::bindBuffer(GL_UNIFORM_BUFFER, NULL);
+}
+
+void DrawData::initialize() {
+    // start from identity matrices and white
+    for (GLuint i{ 0 }; i != DRAW_DATA_CAPACITY; ++i)
+        setDraw(static_cast<Rendering::DrawSlot>(i), glm::mat4());
+
+    // allocate uniform buffer and bind it to its binding point for good,
+    // shaders bind their Draws block to the same point when linked
+    glGenBuffers(1, &m_drawsUBO);
+    GLState::bindBuffer(GL_UNIFORM_BUFFER, m_drawsUBO);
+    glBufferData(GL_UNIFORM_BUFFER,
+        sizeof(m_draws),
+        NULL,
+        GL_STREAM_DRAW);
+    GLState::bindBufferBase(GL_UNIFORM_BUFFER,
+        UNIFORM_BLOCK_BINDING_DRAWS,
+        m_drawsUBO);
+
+    GLState::bindBuffer(GL_UNIFORM_BUFFER, NULL);
+}
\ No newline at end of file
@@ -0,0 +1,48 @@
+#ifndef DRAW_DATA_H
+#define DRAW_DATA_H
+
+// project headers
+#include "constants.h"
+#include "enums.h"
+#include "gl_state.h"
+
+// GLEW
+#include <gl/glew.h>
+
+// GLM
+#include <glm/glm.hpp>
+
+// model matrix and color of the draws that are not instanced, kept in one
+// std140 uniform block array indexed by the u_drawIndex uniform: setters only
+// change the local copy, and upload() sends the whole frame's array with a
+// single buffer update, so each draw sets one index instead of a matrix and
+// a color
+class DrawData {
+public:
+    DrawData() {
+        initialize();
+    }
+
+    // setters
+    void setDraw(Rendering::DrawSlot slot,
+        const glm::mat4& modelMatrix,
+        const glm::vec4& color = glm::vec4(1.0f));
+
+    // utilities
+    void free() const;
+    void upload() const;
+
+private:
+    // std140 layout of one Draws block element
+    struct DrawBlock {
+        glm::mat4 modelMatrix;
+        glm::vec4 color;
+    };
+
+    void initialize();
+
+    DrawBlock m_draws[DRAW_DATA_CAPACITY];
+    GLuint m_drawsUBO;
+};
+
+#endif // !DRAW_DATA_H
\ No newline at end of file
@@ -25,6 +25,37 @@ namespace Rendering {
         FIRST,
         SECOND
     };
+
+    // render queue layers, in drawing order
+    enum Layer {
+        BACKGROUND,
+        SOLID,
+        BLENDED
+    };
+
+    // queued scene elements
+    enum Drawable {
+        SKYBOX,
+        GROUND,
+        MODELS,
+        LIGHTS,
+        FRAME,
+        GRASS_0,
+        GRASS_1,
+        PARTICLES
+    };
+
+    // per-draw data slots of draws that are not instanced
+    enum DrawSlot {
+        DRAW_GROUND,
+        DRAW_SUN,
+        DRAW_MOON,
+        DRAW_AXIS_X,
+        DRAW_AXIS_Y,
+        DRAW_AXIS_Z,
+        DRAW_GRID,
+        DRAW_SLOT_COUNT
+    };
 }
 
 // model transformations
@@ -46,6 +77,93 @@ namespace Transform {
     };
 }
 
+// frame timing
+namespace Timing {
+    // timed rendering stages
+    enum Stage {
+        FIRST_PASS,
+        SECOND_PASS,
+        SKYBOX,
+        GROUND,
+        MODELS,
+        LIGHTS,
+        FRAME,
+        GRASS_0,
+        GRASS_1,
+        PARTICLES,
+        SHADOW_DEBUG,
+        OVERDRAW,
+        HUD,
+        STAGE_COUNT
+    };
+}
+
+// input recording
+namespace Replay {
+    // recorder modes
+    enum Mode {
+        OFF,
+        RECORD,
+        REPLAY
+    };
+
+    // log record tags
+    enum Event {
+        FRAME,
+        KEYBOARD,
+        CURSOR,
+        SCROLL
+    };
+}
+
+// GL call counters
+namespace GLCalls {
+    // counted calls and payloads
+    enum Counter {
+        DRAW,
+        TRIANGLES,
+        UNIFORM,
+        GET_UNIFORM_LOCATION,
+        GET_ATTRIB_LOCATION,
+        USE_PROGRAM,
+        BIND_VERTEX_ARRAY,
+        BIND_TEXTURE,
+        BUFFER_DATA,
+        VERTEX_ATTRIB_POINTER,
+        UPLOADED_BYTES,
+        STATE_HIT,
+        STATE_MISS,
+        COUNTER_COUNT
+    };
+}
+
+// cached GL state
+namespace GLStates {
+    // tracked buffer binding targets
+    enum BufferTarget {
+        ARRAY_BUFFER,
+        ELEMENT_ARRAY_BUFFER,
+        UNIFORM_BUFFER,
+        BUFFER_TARGET_COUNT
+    };
+
+    // tracked texture targets, per texture unit
+    enum TextureTarget {
+        TEXTURE_2D,
+        TEXTURE_2D_ARRAY,
+        TEXTURE_CUBE_MAP,
+        TEXTURE_TARGET_COUNT
+    };
+
+    // tracked capabilities
+    enum Capability {
+        BLEND,
+        CULL_FACE,
+        DEPTH_TEST,
+        CAPABILITY_COUNT
+    };
+}
+
 // shadow calculations
 namespace Shadows {
     // bias
@@ -53,6 +171,12 @@ namespace Shadows {
         INCREASE,
         DECREASE
     };
+
+    // light shadow projection
+    enum Mode {
+        POINT,
+        DIRECTIONAL
+    };
 }
 
 #endif // !ENUMS_H
\ No newline at end of file
@@ -0,0 +1,84 @@
+#include "gl_counters.h"
+
+// running totals since program start
+GLuint64 GLCounters::s_total[GLCalls::COUNTER_COUNT] = {};
+
+// totals at the start of the current frame and of each running stage
+GLuint64 GLCounters::s_frameStart[GLCalls::COUNTER_COUNT] = {};
+GLuint64 GLCounters::s_stageStart[Timing::STAGE_COUNT][GLCalls::COUNTER_COUNT] = {};
+
+// counts of the last completed frame
+GLuint64 GLCounters::s_frame[GLCalls::COUNTER_COUNT] = {};
+GLuint64 GLCounters::s_stage[Timing::STAGE_COUNT][GLCalls::COUNTER_COUNT] = {};
+
+// counts accumulated during the current frame
+GLuint64 GLCounters::s_stageCurrent[Timing::STAGE_COUNT][GLCalls::COUNTER_COUNT] = {};
+
+GLuint64 GLCounters::getFrameCount(GLCalls::Counter counter) {
+    // get count during last frame
+    return s_frame[counter];
+}
+
+GLuint64 GLCounters::getStageCount(Timing::Stage stage,
+    GLCalls::Counter counter) {
+    // get count during stage in last frame
+    return s_stage[stage][counter];
+}
+
+GLuint64 GLCounters::getTotalCount(GLCalls::Counter counter) {
+    // get count since program start
+    return s_total[counter];
+}
+
+void GLCounters::add(GLCalls::Counter counter,
+    GLuint64 value) {
+    // increase counter
+    s_total[counter] += value;
+}
+
+void GLCounters::addDraw(GLenum mode,
+    GLsizei count,
+    GLsizei instances) {
+    // count draw call and the triangles it submits
+    s_total[GLCalls::DRAW] += 1;
+    switch (mode) {
+    case GL_TRIANGLES:
+        s_total[GLCalls::TRIANGLES] += (count / 3) * instances;
+        break;
+    case GL_TRIANGLE_STRIP:
+    case GL_TRIANGLE_FAN:
+        if (count > 2)
+            s_total[GLCalls::TRIANGLES] += (count - 2) * instances;
+        break;
+    }
+}
+
+void GLCounters::beginFrame() {
+    // reset counts accumulated during the current frame
+    for (GLuint i{ 0 }; i != GLCalls::COUNTER_COUNT; ++i) {
+        s_frameStart[i] = s_total[i];
+        for (GLuint j{ 0 }; j != Timing::STAGE_COUNT; ++j)
+            s_stageCurrent[j][i] = 0;
+    }
+}
+
+void GLCounters::beginStage(Timing::Stage stage) {
+    // start counting stage
+    for (GLuint i{ 0 }; i != GLCalls::COUNTER_COUNT; ++i)
+        s_stageStart[stage][i] = s_total[i];
+}
+
+void GLCounters::endFrame() {
+    // publish counts of the frame that just completed
+    for (GLuint i{ 0 }; i != GLCalls::COUNTER_COUNT; ++i) {
+        s_frame[i] = s_total[i] - s_frameStart[i];
+        for (GLuint j{ 0 }; j != Timing::STAGE_COUNT; ++j)
+            s_stage[j][i] = s_stageCurrent[j][i];
+    }
+}
+
+void GLCounters::endStage(Timing::Stage stage) {
+    // stop counting stage, stages run more than once per frame accumulate
+    for (GLuint i{ 0 }; i != GLCalls::COUNTER_COUNT; ++i)
+        s_stageCurrent[stage][i] += s_total[i] - s_stageStart[stage][i];
+}
\ No newline at end of file
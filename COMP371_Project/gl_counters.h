@@ -0,0 +1,274 @@
+#ifndef GL_COUNTERS_H
+#define GL_COUNTERS_H
+
+// project headers
+#include "enums.h"
+
+// GLEW
+#include <gl/glew.h>
+
+// counts of GL calls and uploaded bytes, per frame and per rendering stage
+class GLCounters {
+public:
+    GLCounters() = delete;
+    GLCounters(const GLCounters& counters) = delete;
+    GLCounters(GLCounters&& counters) = delete;
+    GLCounters& operator=(GLCounters& counters) = delete;
+
+    // getters
+    static GLuint64 getFrameCount(GLCalls::Counter counter);
+    static GLuint64 getStageCount(Timing::Stage stage,
+        GLCalls::Counter counter);
+    static GLuint64 getTotalCount(GLCalls::Counter counter);
+
+    // utilities
+    static void add(GLCalls::Counter counter,
+        GLuint64 value = 1);
+    static void addDraw(GLenum mode,
+        GLsizei count,
+        GLsizei instances = 1);
+    static void beginFrame();
+    static void beginStage(Timing::Stage stage);
+    static void endFrame();
+    static void endStage(Timing::Stage stage);
+
+private:
+    static GLuint64 s_total[GLCalls::COUNTER_COUNT];
+    static GLuint64 s_frameStart[GLCalls::COUNTER_COUNT];
+    static GLuint64 s_stageStart[Timing::STAGE_COUNT][GLCalls::COUNTER_COUNT];
+    static GLuint64 s_frame[GLCalls::COUNTER_COUNT];
+    static GLuint64 s_stage[Timing::STAGE_COUNT][GLCalls::COUNTER_COUNT];
+    static GLuint64 s_stageCurrent[Timing::STAGE_COUNT][GLCalls::COUNTER_COUNT];
+};
+
+// the wrapped entry points below replace the GL names for every file that
+// includes this header (through constants.h or texture.h), define
+// DISABLE_GL_COUNTERS to call the driver directly
+#ifndef DISABLE_GL_COUNTERS
+namespace GLCounted {
+    // draws
+    inline void drawArrays(GLenum mode,
+        GLint first,
+        GLsizei count) {
+        GLCounters::addDraw(mode, count);
+        glDrawArrays(mode, first, count);
+    }
+    inline void drawArraysInstanced(GLenum mode,
+        GLint first,
+        GLsizei count,
+        GLsizei instances) {
+        GLCounters::addDraw(mode, count, instances);
+        glDrawArraysInstanced(mode, first, count, instances);
+    }
+    inline void drawElements(GLenum mode,
+        GLsizei count,
+        GLenum type,
+        const void* indices) {
+        GLCounters::addDraw(mode, count);
+        glDrawElements(mode, count, type, indices);
+    }
+    inline void drawElementsInstanced(GLenum mode,
+        GLsizei count,
+        GLenum type,
+        const void* indices,
+        GLsizei instances) {
+        GLCounters::addDraw(mode, count, instances);
+        glDrawElementsInstanced(mode, count, type, indices, instances);
+    }
+
+    // uniforms
+    inline void uniform(GLuint64 bytes) {
+        GLCounters::add(GLCalls::UNIFORM);
+        GLCounters::add(GLCalls::UPLOADED_BYTES, bytes);
+    }
+    inline void uniform1f(GLint location,
+        GLfloat v0) {
+        uniform(sizeof(GLfloat));
+        glUniform1f(location, v0);
+    }
+    inline void uniform2f(GLint location,
+        GLfloat v0,
+        GLfloat v1) {
+        uniform(2 * sizeof(GLfloat));
+        glUniform2f(location, v0, v1);
+    }
+    inline void uniform3f(GLint location,
+        GLfloat v0,
+        GLfloat v1,
+        GLfloat v2) {
+        uniform(3 * sizeof(GLfloat));
+        glUniform3f(location, v0, v1, v2);
+    }
+    inline void uniform4f(GLint location,
+        GLfloat v0,
+        GLfloat v1,
+        GLfloat v2,
+        GLfloat v3) {
+        uniform(4 * sizeof(GLfloat));
+        glUniform4f(location, v0, v1, v2, v3);
+    }
+    inline void uniform1i(GLint location,
+        GLint v0) {
+        uniform(sizeof(GLint));
+        glUniform1i(location, v0);
+    }
+    inline void uniform1ui(GLint location,
+        GLuint v0) {
+        uniform(sizeof(GLuint));
+        glUniform1ui(location, v0);
+    }
+    inline void uniform1iv(GLint location,
+        GLsizei count,
+        const GLint* value) {
+        uniform(count * sizeof(GLint));
+        glUniform1iv(location, count, value);
+    }
+    inline void uniform1fv(GLint location,
+        GLsizei count,
+        const GLfloat* value) {
+        uniform(count * sizeof(GLfloat));
+        glUniform1fv(location, count, value);
+    }
+    inline void uniform2fv(GLint location,
+        GLsizei count,
+        const GLfloat* value) {
+        uniform(2 * count * sizeof(GLfloat));
+        glUniform2fv(location, count, value);
+    }
+    inline void uniform3fv(GLint location,
+        GLsizei count,
+        const GLfloat* value) {
+        uniform(3 * count * sizeof(GLfloat));
+        glUniform3fv(location, count, value);
+    }
+    inline void uniform4fv(GLint location,
+        GLsizei count,
+        const GLfloat* value) {
+        uniform(4 * count * sizeof(GLfloat));
+        glUniform4fv(location, count, value);
+    }
+    inline void uniformMatrix3fv(GLint location,
+        GLsizei count,
+        GLboolean transpose,
+        const GLfloat* value) {
+        uniform(9 * count * sizeof(GLfloat));
+        glUniformMatrix3fv(location, count, transpose, value);
+    }
+    inline void uniformMatrix4fv(GLint location,
+        GLsizei count,
+        GLboolean transpose,
+        const GLfloat* value) {
+        uniform(16 * count * sizeof(GLfloat));
+        glUniformMatrix4fv(location, count, transpose, value);
+    }
+
+    // reflection
+    inline GLint getUniformLocation(GLuint program,
+        const GLchar* name) {
+        GLCounters::add(GLCalls::GET_UNIFORM_LOCATION);
+        return glGetUniformLocation(program, name);
+    }
+    inline GLint getAttribLocation(GLuint program,
+        const GLchar* name) {
+        GLCounters::add(GLCalls::GET_ATTRIB_LOCATION);
+        return glGetAttribLocation(program, name);
+    }
+
+    // state changes
+    inline void useProgram(GLuint program) {
+        GLCounters::add(GLCalls::USE_PROGRAM);
+        glUseProgram(program);
+    }
+    inline void bindVertexArray(GLuint array) {
+        GLCounters::add(GLCalls::BIND_VERTEX_ARRAY);
+        glBindVertexArray(array);
+    }
+    inline void bindTexture(GLenum target,
+        GLuint texture) {
+        GLCounters::add(GLCalls::BIND_TEXTURE);
+        glBindTexture(target, texture);
+    }
+    inline void vertexAttribPointer(GLuint index,
+        GLint size,
+        GLenum type,
+        GLboolean normalized,
+        GLsizei stride,
+        const void* pointer) {
+        GLCounters::add(GLCalls::VERTEX_ATTRIB_POINTER);
+        glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+    }
+
+    // buffer uploads (allocations without data upload nothing)
+    inline void bufferData(GLenum target,
+        GLsizeiptr size,
+        const void* data,
+        GLenum usage) {
+        GLCounters::add(GLCalls::BUFFER_DATA);
+        if (data)
+            GLCounters::add(GLCalls::UPLOADED_BYTES, size);
+        glBufferData(target, size, data, usage);
+    }
+    inline void bufferSubData(GLenum target,
+        GLintptr offset,
+        GLsizeiptr size,
+        const void* data) {
+        GLCounters::add(GLCalls::BUFFER_DATA);
+        GLCounters::add(GLCalls::UPLOADED_BYTES, size);
+        glBufferSubData(target, offset, size, data);
+    }
+}
+
+// route GL names through the wrappers (GLEW defines most of them as macros)
+#undef glDrawArrays
+#undef glDrawArraysInstanced
+#undef glDrawElements
+#undef glDrawElementsInstanced
+#undef glUniform1f
+#undef glUniform2f
+#undef glUniform3f
+#undef glUniform4f
+#undef glUniform1i
+#undef glUniform1ui
+#undef glUniform1iv
+#undef glUniform1fv
+#undef glUniform2fv
+#undef glUniform3fv
+#undef glUniform4fv
+#undef glUniformMatrix3fv
+#undef glUniformMatrix4fv
+#undef glGetUniformLocation
+#undef glGetAttribLocation
+#undef glUseProgram
+#undef glBindVertexArray
+#undef glBindTexture
+#undef glVertexAttribPointer
+#undef glBufferData
+#undef glBufferSubData
+#define glDrawArrays GLCounted::drawArrays
+#define glDrawArraysInstanced GLCounted::drawArraysInstanced
+#define glDrawElements GLCounted::drawElements
+#define glDrawElementsInstanced GLCounted::drawElementsInstanced
+#define glUniform1f GLCounted::uniform1f
+#define glUniform2f GLCounted::uniform2f
+#define glUniform3f GLCounted::uniform3f
+#define glUniform4f GLCounted::uniform4f
+#define glUniform1i GLCounted::uniform1i
+#define glUniform1ui GLCounted::uniform1ui
+#define glUniform1iv GLCounted::uniform1iv
+#define glUniform1fv GLCounted::uniform1fv
+#define glUniform2fv GLCounted::uniform2fv
+#define glUniform3fv GLCounted::uniform3fv
+#define glUniform4fv GLCounted::uniform4fv
+#define glUniformMatrix3fv GLCounted::uniformMatrix3fv
+#define glUniformMatrix4fv GLCounted::uniformMatrix4fv
+#define glGetUniformLocation GLCounted::getUniformLocation
+#define glGetAttribLocation GLCounted::getAttribLocation
+#define glUseProgram GLCounted::useProgram
+#define glBindVertexArray GLCounted::bindVertexArray
+#define glBindTexture GLCounted::bindTexture
+#define glVertexAttribPointer GLCounted::vertexAttribPointer
+#define glBufferData GLCounted::bufferData
+#define glBufferSubData GLCounted::bufferSubData
+#endif // !DISABLE_GL_COUNTERS
+
+#endif // !GL_COUNTERS_H
\ No newline at end of file
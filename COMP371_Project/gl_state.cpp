@@ -0,0 +1,264 @@
+#include "gl_state.h"
+
+// initially bound program, vertex array, buffers and framebuffer
+GLuint GLState::s_program = NULL;
+GLuint GLState::s_VAO = NULL;
+GLuint GLState::s_buffers[GLStates::BUFFER_TARGET_COUNT] = {};
+GLuint GLState::s_FBO = NULL;
+
+// initially active texture unit and bound textures
+GLenum GLState::s_activeTextureUnit = GL_TEXTURE0;
+GLuint GLState::s_textures[GL_STATE_TEXTURE_UNITS][GLStates::TEXTURE_TARGET_COUNT] = {};
+
+// initial capabilities (all disabled)
+bool GLState::s_capabilities[GLStates::CAPABILITY_COUNT] = {};
+
+// initial blending, depth and raster state
+GLenum GLState::s_blendSource = GL_ONE;
+GLenum GLState::s_blendDestination = GL_ZERO;
+glm::vec4 GLState::s_clearColor{ 0.0f, 0.0f, 0.0f, 0.0f };
+GLenum GLState::s_cullFace = GL_BACK;
+GLenum GLState::s_depthFunction = GL_LESS;
+GLboolean GLState::s_depthMask = GL_TRUE;
+GLfloat GLState::s_lineWidth = 1.0f;
+GLfloat GLState::s_pointSize = 1.0f;
+GLenum GLState::s_polygonMode = GL_FILL;
+
+// initial viewport is the window size, unknown here
+glm::ivec4 GLState::s_viewport{ -1, -1, -1, -1 };
+
+GLuint GLState::getVertexArray() {
+    // get bound vertex array object
+    return s_VAO;
+}
+
+void GLState::activateTextureUnit(GLenum textureUnit) {
+    // activate texture unit if needed
+    if (isCached(textureUnit == s_activeTextureUnit))
+        return;
+
+    glActiveTexture(textureUnit);
+    s_activeTextureUnit = textureUnit;
+}
+
+void GLState::bindBuffer(GLenum target,
+    GLuint buffer) {
+    // bind buffer if needed, untracked targets always reach the driver
+    GLint index = getBufferIndex(target);
+    if (index != -1 && isCached(buffer == s_buffers[index]))
+        return;
+
+    glBindBuffer(target, buffer);
+    if (index != -1)
+        s_buffers[index] = buffer;
+}
+
+void GLState::bindBufferBase(GLenum target,
+    GLuint index,
+    GLuint buffer) {
+    // bind buffer to indexed binding point, which also binds it to the
+    // generic target
+    glBindBufferBase(target, index, buffer);
+    GLCounters::add(GLCalls::STATE_MISS);
+
+    GLint bufferIndex = getBufferIndex(target);
+    if (bufferIndex != -1)
+        s_buffers[bufferIndex] = buffer;
+}
+
+void GLState::bindFramebuffer(GLuint FBO) {
+    // bind framebuffer for both drawing and reading if needed
+    if (isCached(FBO == s_FBO))
+        return;
+
+    glBindFramebuffer(GL_FRAMEBUFFER, FBO);
+    s_FBO = FBO;
+}
+
+void GLState::bindTexture(GLenum target,
+    GLuint texture) {
+    // bind texture to active unit if needed
+    GLuint unit = s_activeTextureUnit - GL_TEXTURE0;
+    GLint index = getTextureIndex(target);
+    if (index != -1
+        && unit < GL_STATE_TEXTURE_UNITS
+        && isCached(texture == s_textures[unit][index]))
+        return;
+
+    glBindTexture(target, texture);
+    if (index != -1 && unit < GL_STATE_TEXTURE_UNITS)
+        s_textures[unit][index] = texture;
+}
+
+void GLState::bindVertexArray(GLuint VAO) {
+    // bind vertex array object if needed
+    if (isCached(VAO == s_VAO))
+        return;
+
+    glBindVertexArray(VAO);
+    s_VAO = VAO;
+
+    // element array binding belongs to the vertex array object
+    s_buffers[GLStates::ELEMENT_ARRAY_BUFFER] = GL_STATE_UNKNOWN;
+}
+
+void GLState::useProgram(GLuint program) {
+    // use shader program if needed
+    if (isCached(program == s_program))
+        return;
+
+    glUseProgram(program);
+    s_program = program;
+}
+
+void GLState::setBlendFunc(GLenum source,
+    GLenum destination) {
+    // set blending factors if needed
+    if (isCached(source == s_blendSource
+        && destination == s_blendDestination))
+        return;
+
+    glBlendFunc(source, destination);
+    s_blendSource = source;
+    s_blendDestination = destination;
+}
+
+void GLState::setCapability(GLenum capability,
+    bool enabled) {
+    // enable or disable capability if needed
+    GLint index = getCapabilityIndex(capability);
+    if (index != -1 && isCached(enabled == s_capabilities[index]))
+        return;
+
+    if (enabled)
+        glEnable(capability);
+    else
+        glDisable(capability);
+    if (index != -1)
+        s_capabilities[index] = enabled;
+}
+
+void GLState::setClearColor(const glm::vec4& color) {
+    // set clear color if needed
+    if (isCached(color == s_clearColor))
+        return;
+
+    glClearColor(color.r, color.g, color.b, color.a);
+    s_clearColor = color;
+}
+
+void GLState::setCullFace(GLenum face) {
+    // set culled faces if needed
+    if (isCached(face == s_cullFace))
+        return;
+
+    glCullFace(face);
+    s_cullFace = face;
+}
+
+void GLState::setDepthFunc(GLenum function) {
+    // set depth comparison if needed
+    if (isCached(function == s_depthFunction))
+        return;
+
+    glDepthFunc(function);
+    s_depthFunction = function;
+}
+
+void GLState::setDepthMask(GLboolean mask) {
+    // set depth writes if needed
+    if (isCached(mask == s_depthMask))
+        return;
+
+    glDepthMask(mask);
+    s_depthMask = mask;
+}
+
+void GLState::setLineWidth(GLfloat width) {
+    // set line width if needed
+    if (isCached(width == s_lineWidth))
+        return;
+
+    glLineWidth(width);
+    s_lineWidth = width;
+}
+
+void GLState::setPointSize(GLfloat size) {
+    // set point size if needed
+    if (isCached(size == s_pointSize))
+        return;
+
+    glPointSize(size);
+    s_pointSize = size;
+}
+
+void GLState::setPolygonMode(GLenum mode) {
+    // set polygon mode for both faces if needed
+    if (isCached(mode == s_polygonMode))
+        return;
+
+    glPolygonMode(GL_FRONT_AND_BACK, mode);
+    s_polygonMode = mode;
+}
+
+void GLState::setViewport(GLint x,
+    GLint y,
+    GLsizei width,
+    GLsizei height) {
+    // set viewport if needed
+    glm::ivec4 viewport{ x, y, width, height };
+    if (isCached(viewport == s_viewport))
+        return;
+
+    glViewport(x, y, width, height);
+    s_viewport = viewport;
+}
+
+bool GLState::isCached(bool unchanged) {
+    // count call as cache hit or miss
+    GLCounters::add(unchanged ? GLCalls::STATE_HIT : GLCalls::STATE_MISS);
+
+    return unchanged;
+}
+
+GLint GLState::getBufferIndex(GLenum target) {
+    // get tracked buffer target index, -1 if untracked
+    switch (target) {
+    case GL_ARRAY_BUFFER:
+        return GLStates::ARRAY_BUFFER;
+    case GL_ELEMENT_ARRAY_BUFFER:
+        return GLStates::ELEMENT_ARRAY_BUFFER;
+    case GL_UNIFORM_BUFFER:
+        return GLStates::UNIFORM_BUFFER;
+    default:
+        return -1;
+    }
+}
+
+GLint GLState::getCapabilityIndex(GLenum capability) {
+    // get tracked capability index, -1 if untracked
+    switch (capability) {
+    case GL_BLEND:
+        return GLStates::BLEND;
+    case GL_CULL_FACE:
+        return GLStates::CULL_FACE;
+    case GL_DEPTH_TEST:
+        return GLStates::DEPTH_TEST;
+    default:
+        return -1;
+    }
+}
+
+GLint GLState::getTextureIndex(GLenum target) {
+    // get tracked texture target index, -1 if untracked
+    switch (target) {
+    case GL_TEXTURE_2D:
+        return GLStates::TEXTURE_2D;
+    case GL_TEXTURE_2D_ARRAY:
+        return GLStates::TEXTURE_2D_ARRAY;
+    case GL_TEXTURE_CUBE_MAP:
+        return GLStates::TEXTURE_CUBE_MAP;
+    default:
+        return -1;
+    }
+}
\ No newline at end of file
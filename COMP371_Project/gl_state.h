@@ -0,0 +1,85 @@
+#ifndef GL_STATE_H
+#define GL_STATE_H
+
+// project headers
+#include "constants.h"
+#include "enums.h"
+#include "gl_counters.h"
+
+// GLEW
+#include <gl/glew.h>
+
+// GLM
+#include <glm/glm.hpp>
+
+// shadow copy of the GL state the renderer changes: bindings, per-unit
+// textures, capabilities, blending, depth and raster state; calls that
+// would not change anything never reach the driver, and every call counts
+// as a cache hit or miss in GLCounters (all state changes must go through
+// here, or the copy goes stale)
+class GLState {
+public:
+    GLState() = delete;
+    GLState(const GLState& state) = delete;
+    GLState(GLState&& state) = delete;
+    GLState& operator=(GLState& state) = delete;
+
+    // getters
+    static GLuint getVertexArray();
+
+    // bindings
+    static void activateTextureUnit(GLenum textureUnit);
+    static void bindBuffer(GLenum target,
+        GLuint buffer);
+    static void bindBufferBase(GLenum target,
+        GLuint index,
+        GLuint buffer);
+    static void bindFramebuffer(GLuint FBO);
+    static void bindTexture(GLenum target,
+        GLuint texture);
+    static void bindVertexArray(GLuint VAO);
+    static void useProgram(GLuint program);
+
+    // fixed-function state
+    static void setBlendFunc(GLenum source,
+        GLenum destination);
+    static void setCapability(GLenum capability,
+        bool enabled);
+    static void setClearColor(const glm::vec4& color);
+    static void setCullFace(GLenum face);
+    static void setDepthFunc(GLenum function);
+    static void setDepthMask(GLboolean mask);
+    static void setLineWidth(GLfloat width);
+    static void setPointSize(GLfloat size);
+    static void setPolygonMode(GLenum mode);
+    static void setViewport(GLint x,
+        GLint y,
+        GLsizei width,
+        GLsizei height);
+
+private:
+    static bool isCached(bool unchanged);
+    static GLint getBufferIndex(GLenum target);
+    static GLint getCapabilityIndex(GLenum capability);
+    static GLint getTextureIndex(GLenum target);
+
+    static GLuint s_program;
+    static GLuint s_VAO;
+    static GLuint s_buffers[GLStates::BUFFER_TARGET_COUNT];
+    static GLuint s_FBO;
+    static GLenum s_activeTextureUnit;
+    static GLuint s_textures[GL_STATE_TEXTURE_UNITS][GLStates::TEXTURE_TARGET_COUNT];
+    static bool s_capabilities[GLStates::CAPABILITY_COUNT];
+    static GLenum s_blendSource;
+    static GLenum s_blendDestination;
+    static glm::vec4 s_clearColor;
+    static GLenum s_cullFace;
+    static GLenum s_depthFunction;
+    static GLboolean s_depthMask;
+    static GLfloat s_lineWidth;
+    static GLfloat s_pointSize;
+    static GLenum s_polygonMode;
+    static glm::ivec4 s_viewport;
+};
+
+#endif // !GL_STATE_H
\ No newline at end of file
@@ -0,0 +1,188 @@
+#include "gpu_timer.h"
+
+// C++ standard library headers
+#include <fstream>
+#include <iostream>
+
+// query objects (begin and end timestamps), one set per frame in flight
+GLuint GPUTimer::s_frameQueries[GPU_TIMER_LATENCY][2] = {};
+GLuint GPUTimer::s_stageQueries[GPU_TIMER_LATENCY][Timing::STAGE_COUNT][2] = {};
+
+// whether queries were issued in a given slot (stages may be skipped)
+bool GPUTimer::s_frameIssued[GPU_TIMER_LATENCY] = {};
+bool GPUTimer::s_stageIssued[GPU_TIMER_LATENCY][Timing::STAGE_COUNT] = {};
+GLuint GPUTimer::s_frameNumber[GPU_TIMER_LATENCY] = {};
+
+// resolved timings
+std::deque<GPUTimer::Sample> GPUTimer::s_history;
+GPUTimer::Sample GPUTimer::s_latest = {};
+
+// ring state
+GLuint GPUTimer::s_frame = 0;
+GLuint GPUTimer::s_framesResolved = 0;
+GLuint GPUTimer::s_slot = 0;
+bool GPUTimer::s_enabled = true;
+bool GPUTimer::s_initialized = false;
+
+GLdouble GPUTimer::getFrameTime() {
+    // get GPU duration of the latest resolved frame
+    return s_latest.frameTime;
+}
+
+GLuint GPUTimer::getFramesResolved() {
+    // get number of frames whose timings have been read back
+    return s_framesResolved;
+}
+
+GLdouble GPUTimer::getStageTime(Timing::Stage stage) {
+    // get GPU duration of stage in the latest resolved frame
+    return s_latest.stageTime[stage];
+}
+
+bool GPUTimer::isEnabled() {
+    // get whether timer queries are issued
+    return s_enabled;
+}
+
+void GPUTimer::setEnabled(bool value) {
+    // set whether timer queries should be issued
+    s_enabled = value;
+}
+
+void GPUTimer::beginFrame() {
+    if (!s_enabled)
+        return;
+
+    if (!s_initialized)
+        initialize();
+
+    // advance to the oldest slot, read back its results before reuse
+    s_slot = (s_slot + 1) % GPU_TIMER_LATENCY;
+    resolve(s_slot);
+
+    s_frameNumber[s_slot] = s_frame++;
+    for (GLuint i{ 0 }; i != Timing::STAGE_COUNT; ++i)
+        s_stageIssued[s_slot][i] = false;
+    glQueryCounter(s_frameQueries[s_slot][0], GL_TIMESTAMP);
+}
+
+void GPUTimer::beginStage(Timing::Stage stage) {
+    // record timestamp before stage commands (timestamps nest, unlike
+    // GL_TIME_ELAPSED queries, so passes and their sub-passes can overlap)
+    if (!s_enabled || !s_initialized)
+        return;
+
+    glQueryCounter(s_stageQueries[s_slot][stage][0], GL_TIMESTAMP);
+}
+
+void GPUTimer::endFrame() {
+    if (!s_enabled || !s_initialized)
+        return;
+
+    // record timestamp after frame commands
+    glQueryCounter(s_frameQueries[s_slot][1], GL_TIMESTAMP);
+    s_frameIssued[s_slot] = true;
+}
+
+void GPUTimer::endStage(Timing::Stage stage) {
+    if (!s_enabled || !s_initialized)
+        return;
+
+    // record timestamp after stage commands (a stage is timed once per frame)
+    glQueryCounter(s_stageQueries[s_slot][stage][1], GL_TIMESTAMP);
+    s_stageIssued[s_slot][stage] = true;
+}
+
+void GPUTimer::free() {
+    // free query objects
+    if (!s_initialized)
+        return;
+
+    glDeleteQueries(GPU_TIMER_LATENCY * 2, &s_frameQueries[0][0]);
+    glDeleteQueries(GPU_TIMER_LATENCY * Timing::STAGE_COUNT * 2,
+        &s_stageQueries[0][0][0]);
+    s_initialized = false;
+}
+
+bool GPUTimer::writeCSV(const std::string& path) {
+    // write resolved timings history, one row per frame
+    std::ofstream file(path);
+    if (!file) {
+        std::cerr << ">>> Failed to write GPU timings: " << path << std::endl;
+
+        return false;
+    }
+
+    file << "frame,total_ms";
+    for (GLuint i{ 0 }; i != Timing::STAGE_COUNT; ++i)
+        file << "," << TIMING_STAGE_NAMES[i] << "_ms";
+    file << std::endl;
+
+    for (std::deque<Sample>::const_iterator it{ s_history.begin() };
+        it != s_history.end();
+        ++it) {
+        file << it->frame << "," << it->frameTime;
+        for (GLuint i{ 0 }; i != Timing::STAGE_COUNT; ++i)
+            file << "," << it->stageTime[i];
+        file << std::endl;
+    }
+
+    std::cout << "GPU timings written to " << path << " ("
+        << s_history.size() << " frames)" << std::endl;
+
+    return true;
+}
+
+void GPUTimer::initialize() {
+    // generate query objects
+    glGenQueries(GPU_TIMER_LATENCY * 2, &s_frameQueries[0][0]);
+    glGenQueries(GPU_TIMER_LATENCY * Timing::STAGE_COUNT * 2,
+        &s_stageQueries[0][0][0]);
+    s_initialized = true;
+}
+
+void GPUTimer::resolve(GLuint slot) {
+    // nothing was issued in this slot yet
+    if (!s_frameIssued[slot])
+        return;
+    s_frameIssued[slot] = false;
+
+    // results should be long available by now, but never wait for them;
+    // the frame is dropped instead
+    GLint available{ 0 };
+    glGetQueryObjectiv(s_frameQueries[slot][1],
+        GL_QUERY_RESULT_AVAILABLE,
+        &available);
+    if (!available)
+        return;
+
+    GLuint64 begin{ 0 };
+    GLuint64 end{ 0 };
+    Sample sample = {};
+    sample.frame = s_frameNumber[slot];
+    glGetQueryObjectui64v(s_frameQueries[slot][0], GL_QUERY_RESULT, &begin);
+    glGetQueryObjectui64v(s_frameQueries[slot][1], GL_QUERY_RESULT, &end);
+    sample.frameTime = (end - begin) / 1.0e6;
+
+    // stage queries were issued before the frame end query, so they are
+    // available as well
+    for (GLuint i{ 0 }; i != Timing::STAGE_COUNT; ++i) {
+        if (!s_stageIssued[slot][i])
+            continue;
+
+        glGetQueryObjectui64v(s_stageQueries[slot][i][0],
+            GL_QUERY_RESULT,
+            &begin);
+        glGetQueryObjectui64v(s_stageQueries[slot][i][1],
+            GL_QUERY_RESULT,
+            &end);
+        sample.stageTime[i] = (end - begin) / 1.0e6;
+    }
+
+    // publish and keep a bounded history for CSV export
+    s_latest = sample;
+    ++s_framesResolved;
+    s_history.push_back(sample);
+    if (s_history.size() > GPU_TIMER_HISTORY)
+        s_history.pop_front();
+}
\ No newline at end of file
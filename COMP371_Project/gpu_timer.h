@@ -0,0 +1,67 @@
+#ifndef GPU_TIMER_H
+#define GPU_TIMER_H
+
+// project headers
+#include "constants.h"
+#include "enums.h"
+
+// GLEW
+#include <gl/glew.h>
+
+// C++ standard library headers
+#include <deque>
+#include <string>
+#include <vector>
+
+// GPU execution time of rendering stages, measured with timestamp queries
+// that are read back GPU_TIMER_LATENCY frames later so the CPU never waits
+class GPUTimer {
+public:
+    GPUTimer() = delete;
+    GPUTimer(const GPUTimer& timer) = delete;
+    GPUTimer(GPUTimer&& timer) = delete;
+    GPUTimer& operator=(GPUTimer& timer) = delete;
+
+    // getters
+    static GLdouble getFrameTime();
+    static GLuint getFramesResolved();
+    static GLdouble getStageTime(Timing::Stage stage);
+    static bool isEnabled();
+
+    // setters
+    static void setEnabled(bool value);
+
+    // utilities
+    static void beginFrame();
+    static void beginStage(Timing::Stage stage);
+    static void endFrame();
+    static void endStage(Timing::Stage stage);
+    static void free();
+    static bool writeCSV(const std::string& path);
+
+private:
+    // timings of one resolved frame (in milliseconds)
+    struct Sample {
+        GLuint frame;
+        GLdouble frameTime;
+        GLdouble stageTime[Timing::STAGE_COUNT];
+    };
+
+    static void initialize();
+    static void resolve(GLuint slot);
+
+    static GLuint s_frameQueries[GPU_TIMER_LATENCY][2];
+    static GLuint s_stageQueries[GPU_TIMER_LATENCY][Timing::STAGE_COUNT][2];
+    static bool s_frameIssued[GPU_TIMER_LATENCY];
+    static bool s_stageIssued[GPU_TIMER_LATENCY][Timing::STAGE_COUNT];
+    static GLuint s_frameNumber[GPU_TIMER_LATENCY];
+    static std::deque<Sample> s_history;
+    static Sample s_latest;
+    static GLuint s_frame;
+    static GLuint s_framesResolved;
+    static GLuint s_slot;
+    static bool s_enabled;
+    static bool s_initialized;
+};
+
+#endif // !GPU_TIMER_H
\ No newline at end of file
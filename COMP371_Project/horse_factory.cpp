@@ -0,0 +1,337 @@
+#include "horse_factory.h"
+
+Animation* HorseFactory::createAnimation() {
+    // create animation
+    Animation* animation = new Animation();
+
+    // head keyframes
+    animation->addStep(new AnimationStep(JOINT_HEAD,
+        AXIS_Z, 0, 15.0f));
+    animation->addStep(new AnimationStep(JOINT_HEAD,
+        AXIS_Z, 1, -5.0f));
+    animation->addStep(new AnimationStep(JOINT_HEAD,
+        AXIS_Z, 2, 5.0f));
+    animation->addStep(new AnimationStep(JOINT_HEAD,
+        AXIS_Z, 3, -5.0f));
+
+    // neck keyframes
+    animation->addStep(new AnimationStep(JOINT_NECK,
+        AXIS_Z, 0, 10.0f));
+    animation->addStep(new AnimationStep(JOINT_NECK,
+        AXIS_Z, 1, 10.0f));
+    animation->addStep(new AnimationStep(JOINT_NECK,
+        AXIS_Z, 2, -5.0f));
+    animation->addStep(new AnimationStep(JOINT_NECK,
+        AXIS_Z, 3, -10.0f));
+
+    // leg upper front right keyframes
+    animation->addStep(new AnimationStep(JOINT_LEG_UPPER_FRONT_RIGHT,
+        AXIS_Z, 0, 35.0f));
+    animation->addStep(new AnimationStep(JOINT_LEG_UPPER_FRONT_RIGHT,
+        AXIS_Z, 1, -40.0f));
+    animation->addStep(new AnimationStep(JOINT_LEG_UPPER_FRONT_RIGHT,
+        AXIS_Z, 2, 80.0f));
+    animation->addStep(new AnimationStep(JOINT_LEG_UPPER_FRONT_RIGHT,
+        AXIS_Z, 3, -20.0f));
+
+    // leg lower front right keyframes
+    animation->addStep(new AnimationStep(JOINT_LEG_LOWER_FRONT_RIGHT,
+        AXIS_Z, 0, -20.0f));
+    animation->addStep(new AnimationStep(JOINT_LEG_LOWER_FRONT_RIGHT,
+        AXIS_Z, 1, -15.0f));
+    animation->addStep(new AnimationStep(JOINT_LEG_LOWER_FRONT_RIGHT,
+        AXIS_Z, 2, -70.0f));
+    animation->addStep(new AnimationStep(JOINT_LEG_LOWER_FRONT_RIGHT,
+        AXIS_Z, 3, 40.0f));
+
+    // leg upper back right keyframes
+    animation->addStep(new AnimationStep(JOINT_LEG_UPPER_BACK_RIGHT,
+        AXIS_Z, 0, -25.0f));
+    animation->addStep(new AnimationStep(JOINT_LEG_UPPER_BACK_RIGHT,
+        AXIS_Z, 1, -65.0f));
+    animation->addStep(new AnimationStep(JOINT_LEG_UPPER_BACK_RIGHT,
+        AXIS_Z, 2, 20.0f));
+    animation->addStep(new AnimationStep(JOINT_LEG_UPPER_BACK_RIGHT,
+        AXIS_Z, 3, -15.0f));
+
+    // leg lower back right keyframes
+    animation->addStep(new AnimationStep(JOINT_LEG_LOWER_BACK_RIGHT,
+        AXIS_Z, 0, 15.0f));
+    animation->addStep(new AnimationStep(JOINT_LEG_LOWER_BACK_RIGHT,
+        AXIS_Z, 1, 25.0f));
+    animation->addStep(new AnimationStep(JOINT_LEG_LOWER_BACK_RIGHT,
+        AXIS_Z, 2, 40.0f));
+    animation->addStep(new AnimationStep(JOINT_LEG_LOWER_BACK_RIGHT,
+        AXIS_Z, 3, -10.0f));
+
+    // leg upper front left keyframes
+    animation->addStep(new AnimationStep(JOINT_LEG_UPPER_FRONT_LEFT,
+        AXIS_Z, 0, 40.0f));
+    animation->addStep(new AnimationStep(JOINT_LEG_UPPER_FRONT_LEFT,
+        AXIS_Z, 1, -35.0f));
+    animation->addStep(new AnimationStep(JOINT_LEG_UPPER_FRONT_LEFT,
+        AXIS_Z, 2, 65.0f));
+    animation->addStep(new AnimationStep(JOINT_LEG_UPPER_FRONT_LEFT,
+        AXIS_Z, 3, -25.0f));
+
+    // leg lower front left keyframes
+    animation->addStep(new AnimationStep(JOINT_LEG_LOWER_FRONT_LEFT,
+        AXIS_Z, 0, -25.0f));
+    animation->addStep(new AnimationStep(JOINT_LEG_LOWER_FRONT_LEFT,
+        AXIS_Z, 1, -20.0f));
+    animation->addStep(new AnimationStep(JOINT_LEG_LOWER_FRONT_LEFT,
+        AXIS_Z, 2, -55.0f));
+    animation->addStep(new AnimationStep(JOINT_LEG_LOWER_FRONT_LEFT,
+        AXIS_Z, 3, 45.0f));
+
+    // leg upper back left keyframes
+    animation->addStep(new AnimationStep(JOINT_LEG_UPPER_BACK_LEFT,
+        AXIS_Z, 0, -30.0f));
+    animation->addStep(new AnimationStep(JOINT_LEG_UPPER_BACK_LEFT,
+        AXIS_Z, 1, -70.0f));
+    animation->addStep(new AnimationStep(JOINT_LEG_UPPER_BACK_LEFT,
+        AXIS_Z, 2, 65.0f));
+    animation->addStep(new AnimationStep(JOINT_LEG_UPPER_BACK_LEFT,
+        AXIS_Z, 3, -25.0f));
+
+    // leg lower back left keyframes
+    animation->addStep(new AnimationStep(JOINT_LEG_LOWER_BACK_LEFT,
+        AXIS_Z, 0, 20.0f));
+    animation->addStep(new AnimationStep(JOINT_LEG_LOWER_BACK_LEFT,
+        AXIS_Z, 1, 30.0f));
+    animation->addStep(new AnimationStep(JOINT_LEG_LOWER_BACK_LEFT,
+        AXIS_Z, 2, 35.0f));
+    animation->addStep(new AnimationStep(JOINT_LEG_LOWER_BACK_LEFT,
+        AXIS_Z, 3, -15.0f));
+
+    // torso keyframes
+    animation->addStep(new AnimationStep(JOINT_TORSO,
+        AXIS_Z, 0, -5.0f));
+    animation->addStep(new AnimationStep(JOINT_TORSO,
+        AXIS_Z, 1, 10.0f));
+    animation->addStep(new AnimationStep(JOINT_TORSO,
+        AXIS_Z, 2, -10.0f));
+    animation->addStep(new AnimationStep(JOINT_TORSO,
+        AXIS_Z, 3, 15.0f));
+
+    return animation;
+}
+
+Model* HorseFactory::createModel(Shader* shader,
+    std::vector<RenderedEntity*>& entities,
+    std::vector<Joint*>& joints) {
+    // vertex data
+    GLuint verticesSize;
+    GLfloat* vertices = VertexLoader::loadCubeFullVertices(&verticesSize);
+
+    // create model entities
+    RenderedEntity* head = new RenderedEntity(shader,
+        POSITION_ORIGIN,
+        0.5f * MODEL_POSITION_RELATIVE_HEAD,
+        vertices,
+        verticesSize,
+        nullptr,
+        NULL,
+        true);
+    delete[] vertices;
+    RenderedEntity* legLowerFrontRight = new RenderedEntity(*head);
+    RenderedEntity* legLowerFrontLeft = new RenderedEntity(*head);
+    RenderedEntity* legLowerBackRight = new RenderedEntity(*head);
+    RenderedEntity* legLowerBackLeft = new RenderedEntity(*head);
+    RenderedEntity* legUpperFrontRight = new RenderedEntity(*head);
+    RenderedEntity* legUpperFrontLeft = new RenderedEntity(*head);
+    RenderedEntity* legUpperBackRight = new RenderedEntity(*head);
+    RenderedEntity* legUpperBackLeft = new RenderedEntity(*head);
+    RenderedEntity* neck = new RenderedEntity(*head);
+    RenderedEntity* torso = new RenderedEntity(*head);
+
+    // set body parts joint pivot points
+    head->setPivot(0.5f * MODEL_POSITION_RELATIVE_HEAD);
+    legLowerFrontRight->setPivot(0.5f * MODEL_POSITION_RELATIVE_LEG_LOWER_FR);
+    legLowerFrontLeft->setPivot(0.5f * MODEL_POSITION_RELATIVE_LEG_LOWER_FL);
+    legLowerBackRight->setPivot(0.5f * MODEL_POSITION_RELATIVE_LEG_LOWER_BR);
+    legLowerBackLeft->setPivot(0.5f * MODEL_POSITION_RELATIVE_LEG_LOWER_BL);
+    legUpperFrontRight->setPivot(0.5f * MODEL_POSITION_RELATIVE_LEG_UPPER_FR);
+    legUpperFrontLeft->setPivot(0.5f * MODEL_POSITION_RELATIVE_LEG_UPPER_FL);
+    legUpperBackRight->setPivot(0.5f * MODEL_POSITION_RELATIVE_LEG_UPPER_BR);
+    legUpperBackLeft->setPivot(0.5f * MODEL_POSITION_RELATIVE_LEG_UPPER_BL);
+    neck->setPivot(0.5f * MODEL_POSITION_RELATIVE_NECK);
+    torso->setPivot(0.5f * MODEL_POSITION_RELATIVE_TORSO);
+
+    // set body parts color
+    head->setColor(MODEL_COLOR_HEAD);
+    legLowerFrontRight->setColor(MODEL_COLOR_LEG_LOWER);
+    legLowerFrontLeft->setColor(MODEL_COLOR_LEG_LOWER);
+    legLowerBackRight->setColor(MODEL_COLOR_LEG_LOWER);
+    legLowerBackLeft->setColor(MODEL_COLOR_LEG_LOWER);
+    legUpperFrontRight->setColor(MODEL_COLOR_LEG_UPPER);
+    legUpperFrontLeft->setColor(MODEL_COLOR_LEG_UPPER);
+    legUpperBackRight->setColor(MODEL_COLOR_LEG_UPPER);
+    legUpperBackLeft->setColor(MODEL_COLOR_LEG_UPPER);
+    neck->setColor(MODEL_COLOR_NECK);
+    torso->setColor(MODEL_COLOR_TORSO);
+
+    // scale body parts
+    head->scale(MODEL_SCALE_HEAD);
+    legLowerFrontRight->scale(MODEL_SCALE_LEG_LOWER);
+    legLowerFrontLeft->scale(MODEL_SCALE_LEG_LOWER);
+    legLowerBackRight->scale(MODEL_SCALE_LEG_LOWER);
+    legLowerBackLeft->scale(MODEL_SCALE_LEG_LOWER);
+    legUpperFrontRight->scale(MODEL_SCALE_LEG_UPPER);
+    legUpperFrontLeft->scale(MODEL_SCALE_LEG_UPPER);
+    legUpperBackRight->scale(MODEL_SCALE_LEG_UPPER);
+    legUpperBackLeft->scale(MODEL_SCALE_LEG_UPPER);
+    neck->scale(MODEL_SCALE_NECK);
+    torso->scale(MODEL_SCALE_TORSO);
+
+    // translate body parts to their appropriate locations
+    head->translate(MODEL_POSITION_RELATIVE_HEAD);
+    legLowerFrontRight->translate(MODEL_POSITION_RELATIVE_LEG_LOWER_FR);
+    legLowerFrontLeft->translate(MODEL_POSITION_RELATIVE_LEG_LOWER_FL);
+    legLowerBackRight->translate(MODEL_POSITION_RELATIVE_LEG_LOWER_BR);
+    legLowerBackLeft->translate(MODEL_POSITION_RELATIVE_LEG_LOWER_BL);
+    legUpperFrontRight->translate(MODEL_POSITION_RELATIVE_LEG_UPPER_FR);
+    legUpperFrontLeft->translate(MODEL_POSITION_RELATIVE_LEG_UPPER_FL);
+    legUpperBackRight->translate(MODEL_POSITION_RELATIVE_LEG_UPPER_BR);
+    legUpperBackLeft->translate(MODEL_POSITION_RELATIVE_LEG_UPPER_BL);
+    neck->translate(MODEL_POSITION_RELATIVE_NECK);
+    torso->translate(MODEL_POSITION_RELATIVE_TORSO);
+
+    // rotate head and neck, set torso rotation
+    head->rotate(MODEL_ORIENTATION_RELATIVE_HEAD.first,
+        MODEL_ORIENTATION_RELATIVE_HEAD.second);
+    neck->rotate(MODEL_ORIENTATION_RELATIVE_NECK.first,
+        MODEL_ORIENTATION_RELATIVE_NECK.second);
+    torso->lockRotation(true);
+
+    // add body parts to entities vector
+    entities.push_back(head);
+    entities.push_back(legLowerFrontRight);
+    entities.push_back(legLowerFrontLeft);
+    entities.push_back(legLowerBackRight);
+    entities.push_back(legLowerBackLeft);
+    entities.push_back(legUpperFrontRight);
+    entities.push_back(legUpperFrontLeft);
+    entities.push_back(legUpperBackRight);
+    entities.push_back(legUpperBackLeft);
+    entities.push_back(neck);
+    entities.push_back(torso);
+
+    // create model object
+    Model* model = new Model();
+
+    // set up model hierarchy
+    model->add(torso);
+    model->attach(neck, torso);
+    model->attach(head, neck);
+    model->attach(legUpperFrontRight, torso);
+    model->attach(legUpperFrontLeft, torso);
+    model->attach(legUpperBackRight, torso);
+    model->attach(legUpperBackLeft, torso);
+    model->attach(legLowerFrontRight, legUpperFrontRight);
+    model->attach(legLowerFrontLeft, legUpperFrontLeft);
+    model->attach(legLowerBackRight, legUpperBackRight);
+    model->attach(legLowerBackLeft, legUpperBackLeft);
+
+    // create model joints
+    Joint* joint0 = new Joint(neck,
+        head,
+        head->getPivot(),
+        MODEL_ROTATION_HEAD_MAX,
+        MODEL_ROTATION_HEAD_MIN);
+    Joint* joint1 = new Joint(torso,
+        neck,
+        neck->getPivot(),
+        MODEL_ROTATION_NECK_MAX,
+        MODEL_ROTATION_NECK_MIN);
+    Joint* joint2 = new Joint(torso,
+        legUpperFrontRight,
+        MODEL_SCALE_LEG_UPPER
+        * legUpperFrontRight->getPivot(),
+        MODEL_ROTATION_LEG_UPPER_MAX,
+        MODEL_ROTATION_LEG_UPPER_MIN);
+    Joint* joint3 = new Joint(legUpperFrontRight,
+        legLowerFrontRight,
+        legLowerFrontRight->getPivot(),
+        MODEL_ROTATION_LEG_LOWER_MAX,
+        MODEL_ROTATION_LEG_LOWER_MIN);
+    Joint* joint4 = new Joint(torso,
+        legUpperBackRight,
+        MODEL_SCALE_LEG_UPPER
+        * legUpperBackRight->getPivot(),
+        MODEL_ROTATION_LEG_UPPER_MAX,
+        MODEL_ROTATION_LEG_UPPER_MIN);
+    Joint* joint5 = new Joint(legUpperBackRight,
+        legLowerBackRight,
+        legLowerBackRight->getPivot(),
+        MODEL_ROTATION_LEG_LOWER_MAX,
+        MODEL_ROTATION_LEG_LOWER_MIN);
+    Joint* joint6 = new Joint(torso,
+        legUpperFrontLeft,
+        MODEL_SCALE_LEG_UPPER
+        * legUpperFrontLeft->getPivot(),
+        MODEL_ROTATION_LEG_UPPER_MAX,
+        MODEL_ROTATION_LEG_UPPER_MIN);
+    Joint* joint7 = new Joint(legUpperFrontLeft,
+        legLowerFrontLeft,
+        legLowerFrontLeft->getPivot(),
+        MODEL_ROTATION_LEG_LOWER_MAX,
+        MODEL_ROTATION_LEG_LOWER_MIN);
+    Joint* joint8 = new Joint(torso,
+        legUpperBackLeft,
+        MODEL_SCALE_LEG_UPPER
+        * legUpperBackLeft->getPivot(),
+        MODEL_ROTATION_LEG_UPPER_MAX,
+        MODEL_ROTATION_LEG_UPPER_MIN);
+    Joint* joint9 = new Joint(legUpperBackLeft,
+        legLowerBackLeft,
+        legLowerBackLeft->getPivot(),
+        MODEL_ROTATION_LEG_LOWER_MAX,
+        MODEL_ROTATION_LEG_LOWER_MIN);
+    Joint* joint10 = new Joint(nullptr,
+        torso,
+        torso->getPivot(),
+        MODEL_ROTATION_TORSO_MAX,
+        MODEL_ROTATION_TORSO_MIN);
+
+    // add model joints to joints vector and to model
+    joints.push_back(joint0);
+    joints.push_back(joint1);
+    joints.push_back(joint2);
+    joints.push_back(joint3);
+    joints.push_back(joint4);
+    joints.push_back(joint5);
+    joints.push_back(joint6);
+    joints.push_back(joint7);
+    joints.push_back(joint8);
+    joints.push_back(joint9);
+    joints.push_back(joint10);
+
+    // add joints to model
+    for (GLuint j = static_cast<GLuint>(joints.size()) - 11; j != joints.size(); ++j)
+        model->addJoint(joints.at(j));
+
+    return model;
+}
+
+Path* HorseFactory::createPath() {
+    // create a sequence of random path steps
+    Path* path = new Path();
+    for (GLuint j{ 0 }; j != Config::get().getPathCount(); ++j) {
+        GLfloat orientation = ((rand() % 2 == 0) ? -1 : 1)
+            * (rand()
+                % static_cast<GLuint>(
+                    (PATHING_DIRECTION_MAX - PATHING_DIRECTION_MIN + 1))
+                + PATHING_DIRECTION_MIN);
+        GLfloat travelTime = (rand()
+            % static_cast<GLuint>(
+                (PATHING_DISTANCE_MAX - PATHING_DISTANCE_MIN + 1))
+            + PATHING_DISTANCE_MIN);
+
+        path->addStep(new PathStep(j,
+            orientation,
+            travelTime));
+    }
+
+    return path;
+}
\ No newline at end of file
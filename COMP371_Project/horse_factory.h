@@ -0,0 +1,39 @@
+#ifndef HORSE_FACTORY_H
+#define HORSE_FACTORY_H
+
+// project headers
+#include "animation.h"
+#include "config.h"
+#include "constants.h"
+#include "joint.h"
+#include "model.h"
+#include "path.h"
+#include "rendered_entity.h"
+#include "shader.h"
+#include "vertex_loader.h"
+
+// GLEW
+#include <gl/glew.h>
+
+// C++ standard library headers
+#include <stdlib.h>
+#include <vector>
+
+// builds the horse model, its gallop animation and random path sequences
+class HorseFactory {
+public:
+    HorseFactory() = delete;
+    HorseFactory(const HorseFactory& factory) = delete;
+    HorseFactory(HorseFactory&& factory) = delete;
+    HorseFactory& operator=(HorseFactory& factory) = delete;
+
+    // creation (created body parts and joints are appended to the given
+    // vectors, which own them)
+    static Animation* createAnimation();
+    static Model* createModel(Shader* shader,
+        std::vector<RenderedEntity*>& entities,
+        std::vector<Joint*>& joints);
+    static Path* createPath();
+};
+
+#endif // !HORSE_FACTORY_H
\ No newline at end of file
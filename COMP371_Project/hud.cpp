@@ -0,0 +1,392 @@
+#include "hud.h"
+
+// C++ standard library headers
+#include <algorithm>
+#include <cctype>
+#include <iomanip>
+#include <sstream>
+
+// 5x7 bitmap font covering ASCII 32 to 95 (lowercase letters are drawn as
+// uppercase), one byte per row from the top, most significant bit leftmost
+const GLubyte HUD_FONT[HUD_FONT_GLYPHS][HUD_FONT_HEIGHT] = {
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // space
+    { 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04 }, // '!'
+    { 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00 }, // '"'
+    { 0x0A, 0x0A, 0x1F, 0x0A, 0x1F, 0x0A, 0x0A }, // '#'
+    { 0x04, 0x0F, 0x14, 0x0E, 0x05, 0x1E, 0x04 }, // '$'
+    { 0x18, 0x19, 0x02, 0x04, 0x08, 0x13, 0x03 }, // '%'
+    { 0x0C, 0x12, 0x14, 0x08, 0x15, 0x12, 0x0D }, // '&'
+    { 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 }, // '''
+    { 0x02, 0x04, 0x08, 0x08, 0x08, 0x04, 0x02 }, // '('
+    { 0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x08 }, // ')'
+    { 0x00, 0x04, 0x15, 0x0E, 0x15, 0x04, 0x00 }, // '*'
+    { 0x00, 0x04, 0x04, 0x1F, 0x04, 0x04, 0x00 }, // '+'
+    { 0x00, 0x00, 0x00, 0x00, 0x0C, 0x04, 0x08 }, // ','
+    { 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00 }, // '-'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C }, // '.'
+    { 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00 }, // '/'
+    { 0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E }, // '0'
+    { 0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E }, // '1'
+    { 0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F }, // '2'
+    { 0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E }, // '3'
+    { 0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02 }, // '4'
+    { 0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E }, // '5'
+    { 0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E }, // '6'
+    { 0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08 }, // '7'
+    { 0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E }, // '8'
+    { 0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C }, // '9'
+    { 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00 }, // ':'
+    { 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x04, 0x08 }, // ';'
+    { 0x02, 0x04, 0x08, 0x10, 0x08, 0x04, 0x02 }, // '<'
+    { 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x00 }, // '='
+    { 0x08, 0x04, 0x02, 0x01, 0x02, 0x04, 0x08 }, // '>'
+    { 0x0E, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04 }, // '?'
+    { 0x0E, 0x11, 0x01, 0x0D, 0x15, 0x15, 0x0E }, // '@'
+    { 0x0E, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11 }, // 'A'
+    { 0x1E, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x1E }, // 'B'
+    { 0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E }, // 'C'
+    { 0x1C, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1C }, // 'D'
+    { 0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F }, // 'E'
+    { 0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10 }, // 'F'
+    { 0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F }, // 'G'
+    { 0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11 }, // 'H'
+    { 0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E }, // 'I'
+    { 0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0C }, // 'J'
+    { 0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11 }, // 'K'
+    { 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F }, // 'L'
+    { 0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11 }, // 'M'
+    { 0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11 }, // 'N'
+    { 0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E }, // 'O'
+    { 0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10 }, // 'P'
+    { 0x0E, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0D }, // 'Q'
+    { 0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11 }, // 'R'
+    { 0x0F, 0x10, 0x10, 0x0E, 0x01, 0x01, 0x1E }, // 'S'
+    { 0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 }, // 'T'
+    { 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E }, // 'U'
+    { 0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04 }, // 'V'
+    { 0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A }, // 'W'
+    { 0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11 }, // 'X'
+    { 0x11, 0x11, 0x0A, 0x04, 0x04, 0x04, 0x04 }, // 'Y'
+    { 0x1F, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1F }, // 'Z'
+    { 0x0E, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0E }, // '['
+    { 0x00, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00 }, // backslash
+    { 0x0E, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0E }, // ']'
+    { 0x04, 0x0A, 0x11, 0x00, 0x00, 0x00, 0x00 }, // '^'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F }, // '_'
+};
+
+void Hud::free() const {
+    // free resources
+    glDeleteVertexArrays(1, &m_VAO);
+    glDeleteTextures(1, &m_fontTextureID);
+}
+
+void Hud::render(GLuint viewportWidth,
+    GLuint viewportHeight,
+    GLuint liveParticles) {
+    // frame interval statistics over the graph window
+    GLdouble frameTime{ 0.0 };
+    GLdouble frameTimeMax{ 0.0 };
+    GLdouble frameTimeSum{ 0.0 };
+    for (GLuint i{ 0 }; i != m_frameCount; ++i) {
+        GLdouble time = m_frameTimes.at((m_frameIndex + HUD_GRAPH_SAMPLES
+            - m_frameCount + i) % HUD_GRAPH_SAMPLES);
+        frameTimeMax = std::max(frameTimeMax, time);
+        frameTimeSum += time;
+        frameTime = time;
+    }
+    GLuint fps = frameTimeSum > 0.0
+        ? static_cast<GLuint>(1000.0 * m_frameCount / frameTimeSum + 0.5)
+        : 0;
+
+    // GPU timings are only available once queries have been read back
+    bool gpuTimings = GPUTimer::isEnabled()
+        && GPUTimer::getFramesResolved() != 0;
+
+    // statistics of the last completed frame, one line each
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(1)
+        << "FRAME " << frameTime << " MS  MAX " << frameTimeMax
+        << " MS  " << fps << " FPS" << std::endl
+        << "CPU " << StageTimer::getFrameTime() << " MS  GPU ";
+    if (gpuTimings)
+        ss << GPUTimer::getFrameTime() << " MS";
+    else
+        ss << "--";
+    ss << std::endl
+        << "SHADOW PASS CPU " << StageTimer::getStageTime(Timing::FIRST_PASS)
+        << "  GPU ";
+    if (gpuTimings)
+        ss << GPUTimer::getStageTime(Timing::FIRST_PASS);
+    else
+        ss << "--";
+    ss << std::endl
+        << "SCENE PASS  CPU " << StageTimer::getStageTime(Timing::SECOND_PASS)
+        << "  GPU ";
+    if (gpuTimings)
+        ss << GPUTimer::getStageTime(Timing::SECOND_PASS);
+    else
+        ss << "--";
+    ss << std::endl
+        << "DRAWS " << GLCounters::getFrameCount(GLCalls::DRAW)
+        << "  TRIANGLES " << GLCounters::getFrameCount(GLCalls::TRIANGLES)
+        << std::endl
+        << "PARTICLES " << liveParticles
+        << "  COLLIDING MODELS " << Collision::getCollidingCount();
+
+    std::vector<std::string> lines;
+    std::string line;
+    GLuint columns{ 0 };
+    while (std::getline(ss, line)) {
+        columns = std::max(columns, static_cast<GLuint>(line.size()));
+        lines.push_back(line);
+    }
+
+    // panel layout (in pixels, from the top left corner)
+    GLfloat advance = (HUD_FONT_WIDTH + 1) * HUD_SCALE;
+    GLfloat lineHeight = (HUD_FONT_HEIGHT + 2) * HUD_SCALE;
+    GLfloat padding = HUD_MARGIN;
+    GLfloat x = HUD_MARGIN + padding;
+    GLfloat y = HUD_MARGIN + padding;
+    GLfloat width = std::max(columns * advance,
+        static_cast<GLfloat>(HUD_GRAPH_SAMPLES));
+    GLfloat height = lines.size() * lineHeight + padding + HUD_GRAPH_HEIGHT;
+
+    // batch background, text and graph
+    m_vertices.clear();
+    addRectangle(HUD_MARGIN,
+        HUD_MARGIN,
+        x + width + padding,
+        y + height + padding,
+        HUD_COLOR_BACKGROUND);
+    for (GLuint i{ 0 }; i != lines.size(); ++i)
+        addText(lines.at(i),
+            x,
+            y + i * lineHeight,
+            i == 0 ? getTimeColor(frameTime) : HUD_COLOR_TEXT);
+    addGraph(x, y + height - HUD_GRAPH_HEIGHT);
+
+    // write batch to this frame's stream buffer region
+    GLintptr offset{ StreamBuffer::write(m_vertices.data(),
+        sizeof(GLfloat) * m_vertices.size()) };
+
+    // set shader uniforms and font texture
+    GLState::useProgram(m_shader.getProgramID());
+    m_shader.setUniform(UNIFORM_HUD_VIEWPORT,
+        glm::vec2(viewportWidth, viewportHeight));
+    GLState::activateTextureUnit(GL_TEXTURE0);
+    GLState::bindTexture(GL_TEXTURE_2D, m_fontTextureID);
+
+    // draw on top of the scene in a single call
+    GLState::setCapability(GL_DEPTH_TEST, false);
+    GLState::bindVertexArray(m_VAO);
+    setVertexAttributes(offset);
+    glDrawArrays(GL_TRIANGLES,
+        0,
+        m_vertices.size() / HUD_VERTEX_SIZE);
+    GLState::setCapability(GL_DEPTH_TEST, true);
+}
+
+void Hud::initialize() {
+    // frame interval history
+    m_frameTimes.resize(HUD_GRAPH_SAMPLES, 0.0);
+    m_frameLast = Clock::now();
+
+    // font texture holds every glyph side by side, followed by a solid
+    // cell used for rectangles (rows are stored bottom up)
+    GLuint textureWidth = (HUD_FONT_GLYPHS + 1) * HUD_FONT_WIDTH;
+    std::vector<GLubyte> texels(textureWidth * HUD_FONT_HEIGHT, 0);
+    for (GLuint glyph{ 0 }; glyph != HUD_FONT_GLYPHS + 1; ++glyph) {
+        for (GLuint row{ 0 }; row != HUD_FONT_HEIGHT; ++row) {
+            for (GLuint column{ 0 }; column != HUD_FONT_WIDTH; ++column) {
+                bool set = glyph == HUD_FONT_GLYPHS
+                    || (HUD_FONT[glyph][row]
+                        & (1 << (HUD_FONT_WIDTH - 1 - column))) != 0;
+                texels.at((HUD_FONT_HEIGHT - 1 - row) * textureWidth
+                    + glyph * HUD_FONT_WIDTH + column) = set ? 255 : 0;
+            }
+        }
+    }
+
+    // generate and bind texture
+    glGenTextures(1, &m_fontTextureID);
+    GLState::activateTextureUnit(GL_TEXTURE0);
+    GLState::bindTexture(GL_TEXTURE_2D, m_fontTextureID);
+
+    // set texture wrapping and filtering parameters
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+    // rows are tightly packed single bytes
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D,
+        0,
+        GL_R8,
+        textureWidth,
+        HUD_FONT_HEIGHT,
+        0,
+        GL_RED,
+        GL_UNSIGNED_BYTE,
+        texels.data());
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+    // generate vertex array object, vertices come from the stream buffer
+    glGenVertexArrays(1, &m_VAO);
+    GLState::bindVertexArray(m_VAO);
+
+    // vertex attribute locations
+    m_positionLocation = glGetAttribLocation(m_shader.getProgramID(),
+        ATTRIBUTE_POSITION.c_str());
+    glEnableVertexAttribArray(m_positionLocation);
+    m_textureLocation = glGetAttribLocation(m_shader.getProgramID(),
+        ATTRIBUTE_TEXTURE.c_str());
+    glEnableVertexAttribArray(m_textureLocation);
+    m_colorLocation = glGetAttribLocation(m_shader.getProgramID(),
+        ATTRIBUTE_COLOR.c_str());
+    glEnableVertexAttribArray(m_colorLocation);
+
+    // set shader uniform
+    GLState::useProgram(m_shader.getProgramID());
+    m_shader.setUniform(UNIFORM_HUD_FONT, 0);
+}
+
+void Hud::addGraph(GLfloat x,
+    GLfloat y) {
+    // one bar per frame interval, newest on the right
+    GLfloat bottom = y + HUD_GRAPH_HEIGHT;
+    for (GLuint i{ 0 }; i != m_frameCount; ++i) {
+        GLdouble time = m_frameTimes.at((m_frameIndex + HUD_GRAPH_SAMPLES
+            - m_frameCount + i) % HUD_GRAPH_SAMPLES);
+        GLfloat barHeight = static_cast<GLfloat>(
+            std::min(time / HUD_GRAPH_TIME_MAX, 1.0) * HUD_GRAPH_HEIGHT);
+        GLfloat barX = x + HUD_GRAPH_SAMPLES - m_frameCount + i;
+        addRectangle(barX,
+            bottom - barHeight,
+            barX + 1.0f,
+            bottom,
+            getTimeColor(time));
+    }
+
+    // guides at one and two target frame times
+    for (GLuint i{ 1 }; i != 3; ++i) {
+        GLfloat guideY = bottom - static_cast<GLfloat>(
+            i * HUD_FRAME_TIME_TARGET / HUD_GRAPH_TIME_MAX * HUD_GRAPH_HEIGHT);
+        addRectangle(x,
+            guideY,
+            x + HUD_GRAPH_SAMPLES,
+            guideY + 1.0f,
+            HUD_COLOR_GUIDE);
+    }
+}
+
+void Hud::addQuad(GLfloat x0,
+    GLfloat y0,
+    GLfloat x1,
+    GLfloat y1,
+    GLfloat u0,
+    GLfloat v0,
+    GLfloat u1,
+    GLfloat v1,
+    const glm::vec4& color) {
+    // append two triangles, (x0, y0) is the top left corner
+    const GLfloat corners[6][4] = {
+        { x0, y0, u0, v1 },
+        { x0, y1, u0, v0 },
+        { x1, y1, u1, v0 },
+        { x0, y0, u0, v1 },
+        { x1, y1, u1, v0 },
+        { x1, y0, u1, v1 }
+    };
+    for (GLuint i{ 0 }; i != 6; ++i) {
+        m_vertices.insert(m_vertices.end(), corners[i], corners[i] + 4);
+        m_vertices.push_back(color.r);
+        m_vertices.push_back(color.g);
+        m_vertices.push_back(color.b);
+        m_vertices.push_back(color.a);
+    }
+}
+
+void Hud::addRectangle(GLfloat x0,
+    GLfloat y0,
+    GLfloat x1,
+    GLfloat y1,
+    const glm::vec4& color) {
+    // sample the solid cell at the end of the font texture
+    GLfloat u = (HUD_FONT_GLYPHS + 0.5f) / (HUD_FONT_GLYPHS + 1);
+    addQuad(x0, y0, x1, y1, u, 0.5f, u, 0.5f, color);
+}
+
+void Hud::addText(const std::string& text,
+    GLfloat x,
+    GLfloat y,
+    const glm::vec4& color) {
+    // one quad per visible character
+    GLfloat advance = (HUD_FONT_WIDTH + 1) * HUD_SCALE;
+    for (GLuint i{ 0 }; i != text.size(); ++i) {
+        GLuint character = static_cast<GLubyte>(
+            toupper(static_cast<GLubyte>(text.at(i))));
+        if (character <= HUD_FONT_FIRST_CHARACTER
+            || character >= HUD_FONT_FIRST_CHARACTER + HUD_FONT_GLYPHS)
+            continue;
+
+        GLfloat u0 = static_cast<GLfloat>(character - HUD_FONT_FIRST_CHARACTER)
+            / (HUD_FONT_GLYPHS + 1);
+        GLfloat u1 = u0 + 1.0f / (HUD_FONT_GLYPHS + 1);
+        addQuad(x + i * advance,
+            y,
+            x + i * advance + HUD_FONT_WIDTH * HUD_SCALE,
+            y + HUD_FONT_HEIGHT * HUD_SCALE,
+            u0,
+            0.0f,
+            u1,
+            1.0f,
+            color);
+    }
+}
+
+const glm::vec4& Hud::getTimeColor(GLdouble time) {
+    // intervals within a quarter of the target are fine, up to twice the
+    // target are slow, longer ones are hitches
+    if (time <= 1.25 * HUD_FRAME_TIME_TARGET)
+        return HUD_COLOR_GOOD;
+    if (time <= 2.0 * HUD_FRAME_TIME_TARGET)
+        return HUD_COLOR_SLOW;
+
+    return HUD_COLOR_HITCH;
+}
+
+void Hud::setVertexAttributes(GLintptr offset) const {
+    // point vertex attributes of the bound vertex array object at the batch
+    // written to the stream buffer at the given offset
+    GLState::bindBuffer(GL_ARRAY_BUFFER, StreamBuffer::getBuffer());
+    glVertexAttribPointer(m_positionLocation,
+        2,
+        GL_FLOAT,
+        GL_FALSE,
+        HUD_VERTEX_SIZE * sizeof(GLfloat),
+        (void*)offset);
+    glVertexAttribPointer(m_textureLocation,
+        2,
+        GL_FLOAT,
+        GL_FALSE,
+        HUD_VERTEX_SIZE * sizeof(GLfloat),
+        (void*)(offset + 2 * sizeof(GLfloat)));
+    glVertexAttribPointer(m_colorLocation,
+        4,
+        GL_FLOAT,
+        GL_FALSE,
+        HUD_VERTEX_SIZE * sizeof(GLfloat),
+        (void*)(offset + 4 * sizeof(GLfloat)));
+}
+
+void Hud::updateFrameTimes() {
+    // store time elapsed since the previous call (in milliseconds)
+    Clock::time_point now = Clock::now();
+    m_frameTimes.at(m_frameIndex) = std::chrono::duration<GLdouble,
+        std::milli>(now - m_frameLast).count();
+    m_frameLast = now;
+    m_frameIndex = (m_frameIndex + 1) % HUD_GRAPH_SAMPLES;
+    m_frameCount = std::min(m_frameCount + 1, HUD_GRAPH_SAMPLES);
+}
\ No newline at end of file
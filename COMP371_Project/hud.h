@@ -0,0 +1,85 @@
+#ifndef HUD_H
+#define HUD_H
+
+// project headers
+#include "collision.h"
+#include "constants.h"
+#include "gl_counters.h"
+#include "gpu_timer.h"
+#include "shader.h"
+#include "stage_timer.h"
+#include "stream_buffer.h"
+
+// GLEW
+#include <gl/glew.h>
+
+// GLM
+#include <glm/glm.hpp>
+
+// C++ standard library headers
+#include <chrono>
+#include <string>
+#include <vector>
+
+// on-screen performance overlay: frame, stage and GL call statistics as
+// bitmap-font text, and a rolling graph of frame intervals, all batched
+// into a single draw call
+class Hud {
+public:
+    Hud() {
+        initialize();
+    }
+
+    // utilities
+    void free() const;
+    void render(GLuint viewportWidth,
+        GLuint viewportHeight,
+        GLuint liveParticles);
+    void updateFrameTimes();
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    void initialize();
+
+    // batching
+    void addGraph(GLfloat x,
+        GLfloat y);
+    void addQuad(GLfloat x0,
+        GLfloat y0,
+        GLfloat x1,
+        GLfloat y1,
+        GLfloat u0,
+        GLfloat v0,
+        GLfloat u1,
+        GLfloat v1,
+        const glm::vec4& color);
+    void addRectangle(GLfloat x0,
+        GLfloat y0,
+        GLfloat x1,
+        GLfloat y1,
+        const glm::vec4& color);
+    void addText(const std::string& text,
+        GLfloat x,
+        GLfloat y,
+        const glm::vec4& color);
+
+    // utilities
+    static const glm::vec4& getTimeColor(GLdouble time);
+    void setVertexAttributes(GLintptr offset) const;
+
+    Shader m_shader{ PATH_VERTEX_HUD,
+        PATH_FRAGMENT_HUD };
+    std::vector<GLfloat> m_vertices;
+    std::vector<GLdouble> m_frameTimes;
+    Clock::time_point m_frameLast;
+    GLuint m_frameIndex{ 0 };
+    GLuint m_frameCount{ 0 };
+    GLuint m_VAO;
+    GLuint m_positionLocation;
+    GLuint m_textureLocation;
+    GLuint m_colorLocation;
+    GLuint m_fontTextureID;
+};
+
+#endif // !HUD_H
\ No newline at end of file
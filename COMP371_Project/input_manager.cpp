@@ -7,6 +7,16 @@ InputManager& InputManager::get() {
     return s_instance;
 }
 
+GLuint InputManager::getMouseButtons(GLFWwindow* window) const {
+    // get mask of pressed mouse buttons (bit per GLFW button id)
+    GLuint mask{ 0 };
+    for (int i{ GLFW_MOUSE_BUTTON_1 }; i <= GLFW_MOUSE_BUTTON_LAST; ++i)
+        if (isMouseButtonPressed(window, i))
+            mask |= 1 << i;
+
+    return mask;
+}
+
 void InputManager::processCursor(GLFWwindow* window,
     double posX,
     double posY) const {
@@ -24,21 +34,21 @@ void InputManager::processCursor(GLFWwindow* window,
     }
 
     // adjust camera position
-    if (glfwGetMouseButton(window, GLFW_MOUSE_BUTTON_RIGHT)
-        && !glfwGetMouseButton(window, GLFW_MOUSE_BUTTON_LEFT)) {
+    if (isMouseButtonPressed(window, GLFW_MOUSE_BUTTON_RIGHT)
+        && !isMouseButtonPressed(window, GLFW_MOUSE_BUTTON_LEFT)) {
         Camera::get().move(Eye::Displacement::RIGHT, offX);
     }
 
     // adjust camera zoom
-    if (glfwGetMouseButton(window, GLFW_MOUSE_BUTTON_LEFT)
-        && !glfwGetMouseButton(window, GLFW_MOUSE_BUTTON_RIGHT)) {
+    if (isMouseButtonPressed(window, GLFW_MOUSE_BUTTON_LEFT)
+        && !isMouseButtonPressed(window, GLFW_MOUSE_BUTTON_RIGHT)) {
         Camera::get().setFOV(Camera::get().getFOV() - offY);
         Camera::get().clampFOV();
     }
 
-    if (glfwGetMouseButton(window, GLFW_MOUSE_BUTTON_MIDDLE)
-        || (glfwGetMouseButton(window, GLFW_MOUSE_BUTTON_LEFT)
-            && glfwGetMouseButton(window, GLFW_MOUSE_BUTTON_RIGHT))) {
+    if (isMouseButtonPressed(window, GLFW_MOUSE_BUTTON_MIDDLE)
+        || (isMouseButtonPressed(window, GLFW_MOUSE_BUTTON_LEFT)
+            && isMouseButtonPressed(window, GLFW_MOUSE_BUTTON_RIGHT))) {
         // update camera x and y
         Camera::get().setMouseX(posX_);
         Camera::get().setMouseY(posY_);
@@ -363,6 +373,16 @@ void InputManager::processKeyboard(GLFWwindow* window,
         && action == GLFW_PRESS)
         Renderer::get().toggleShadows();
 
+    // toggle shadow mode
+    if (key == GLFW_KEY_N
+        && action == GLFW_PRESS)
+        Renderer::get().toggleShadowMode();
+
+    // toggle adaptive shadow quality
+    if (key == GLFW_KEY_K
+        && action == GLFW_PRESS)
+        Renderer::get().toggleShadowBudget();
+
     // toggle axes and grid
     if (key == GLFW_KEY_C
         && action == GLFW_PRESS)
@@ -373,6 +393,11 @@ void InputManager::processKeyboard(GLFWwindow* window,
         && action == GLFW_PRESS)
         Renderer::get().toggleDebugging();
 
+    // toggle overdraw view
+    if (key == GLFW_KEY_O
+        && action == GLFW_PRESS)
+        Renderer::get().toggleOverdraw();
+
     // toggle pathing
     if (key == GLFW_KEY_H
         && action == GLFW_PRESS)
@@ -393,6 +418,21 @@ void InputManager::processKeyboard(GLFWwindow* window,
         && action == GLFW_PRESS)
         Renderer::get().toggleRain();
 
+    // toggle performance overlay
+    if (key == GLFW_KEY_F1
+        && action == GLFW_PRESS)
+        Renderer::get().toggleHud();
+
+    // dump profiler trace
+    if (key == GLFW_KEY_F9
+        && action == GLFW_PRESS)
+        Profiler::writeTrace(PATH_PROFILER_TRACE);
+
+    // dump GPU stage timings
+    if (key == GLFW_KEY_F10
+        && action == GLFW_PRESS)
+        GPUTimer::writeCSV(PATH_GPU_TIMINGS);
+
     // shadow calculations parameters
     if (key == GLFW_KEY_LEFT_BRACKET
         && action == GLFW_PRESS) {
@@ -440,4 +480,13 @@ void InputManager::processScroll(GLFWwindow* window,
     double offX,
     double offY) const {
     // currently unused
+}
+
+bool InputManager::isMouseButtonPressed(GLFWwindow* window,
+    int button) const {
+    // get recorded button state while replaying, live state otherwise
+    if (Recorder::get().isReplaying())
+        return (Recorder::get().getMouseButtons() & (1 << button)) != 0;
+
+    return glfwGetMouseButton(window, button) == GLFW_PRESS;
 }
\ No newline at end of file
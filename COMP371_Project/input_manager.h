@@ -3,6 +3,7 @@
 
 // project headers
 #include "camera.h"
+#include "recorder.h"
 #include "renderer.h"
 
 // GLFW
@@ -16,6 +17,9 @@ public:
     InputManager& operator=(InputManager& manager) = delete;
     static InputManager& get();
 
+    // getters
+    GLuint getMouseButtons(GLFWwindow* window) const;
+
     void processCursor(GLFWwindow* window,
         double posX,
         double posY) const;
@@ -31,6 +35,9 @@ public:
 private:
     InputManager() {}
 
+    bool isMouseButtonPressed(GLFWwindow* window,
+        int button) const;
+
     static InputManager& s_instance;
 };
 
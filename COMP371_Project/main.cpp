@@ -1,8 +1,12 @@
 // project headers
 #include "camera.h"
+#include "config.h"
 #include "constants.h"
 #include "renderer.h"
 #include "input_manager.h"
+#include "profiler.h"
+#include "recorder.h"
+#include "startup_report.h"
 
 // GLEW
 #include <gl/glew.h>
@@ -12,11 +16,15 @@
 
 // C++ standard library headers
 #include <stdlib.h>
+#include <string>
 
 void callbackCursorPos(GLFWwindow* window,
     double posX,
     double posY) {
     // cursor callback
+    Recorder::get().recordCursor(posX,
+        posY,
+        InputManager::get().getMouseButtons(window));
     InputManager::get().processCursor(window, posX, posY);
 }
 
@@ -32,6 +40,7 @@ void callbackKeyboard(GLFWwindow* window,
     int action,
     int mods) {
     // keyboard callback
+    Recorder::get().recordKeyboard(key, scanCode, action, mods);
     InputManager::get().processKeyboard(window, key, scanCode, action, mods);
 }
 
@@ -39,6 +48,7 @@ void callbackScroll(GLFWwindow* window,
     double offX,
     double offY) {
     // scroll callback
+    Recorder::get().recordScroll(offX, offY);
     InputManager::get().processScroll(window, offX, offY);
 }
 
@@ -46,25 +56,77 @@ void callbackWindowResize(GLFWwindow* window,
     int width,
     int height) {
     // adjust viewport when window is resized
-    glViewport(0, 0, width, height);
+    GLState::setViewport(0, 0, width, height);
     Camera::get().setViewportDimensions(width, height);
+    Renderer::get().updateProjectionMatrix();
+}
+
+void callbackCursorPosLive(GLFWwindow* window,
+    double posX,
+    double posY) {
+    // live cursor input is ignored while replaying
+    if (!Recorder::get().isReplaying())
+        callbackCursorPos(window, posX, posY);
+}
+
+void callbackKeyboardLive(GLFWwindow* window,
+    int key,
+    int scanCode,
+    int action,
+    int mods) {
+    // live keyboard input is ignored while replaying, except for escape
+    if (!Recorder::get().isReplaying()
+        || key == GLFW_KEY_ESCAPE)
+        callbackKeyboard(window, key, scanCode, action, mods);
+}
+
+void callbackScrollLive(GLFWwindow* window,
+    double offX,
+    double offY) {
+    // live scroll input is ignored while replaying
+    if (!Recorder::get().isReplaying())
+        callbackScroll(window, offX, offY);
 }
 
 int main(int argc, char* argv[]) {
+    // read scene scale (--troops N, --grass N, --config <file>, ...)
+    if (!Config::get().load(argc, argv))
+        return 1;
+
+    // record or replay input (--record <log> or --replay <log>), write
+    // startup time breakdown (--startup-report <file>)
+    std::string startupReport;
+    for (int i{ 1 }; i + 1 < argc; ++i) {
+        std::string arg{ argv[i] };
+        if (arg == "--record")
+            Recorder::get().startRecording(argv[++i]);
+        else if (arg == "--replay")
+            Recorder::get().startReplay(argv[++i]);
+        else if (arg == "--startup-report")
+            startupReport = argv[++i];
+    }
+    Recorder::get().setCallbacks(callbackKeyboard,
+        callbackCursorPos,
+        callbackScroll);
+
     // set up error callback
     glfwSetErrorCallback(callbackError);
 
     // initialize GLFW and create window
-    glfwInit();
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-    glfwWindowHint(GLFW_DEPTH_BITS, 24);
-    GLFWwindow* window = glfwCreateWindow(SCREEN_WIDTH,
-        SCREEN_HEIGHT,
-        WINDOW_TITLE.c_str(),
-        NULL,
-        NULL);
+    GLFWwindow* window;
+    {
+        STARTUP_SCOPE("create window");
+        glfwInit();
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+        glfwWindowHint(GLFW_DEPTH_BITS, 24);
+        window = glfwCreateWindow(SCREEN_WIDTH,
+            SCREEN_HEIGHT,
+            WINDOW_TITLE.c_str(),
+            NULL,
+            NULL);
+    }
     if (!window) {
         std::cerr << ">>> Failed to create GLFW window" << std::endl;
         glfwTerminate();
@@ -74,9 +136,12 @@ int main(int argc, char* argv[]) {
     glfwMakeContextCurrent(window);
 
     // initialize GLEW
-    glewExperimental = GL_TRUE;
-    if (glewInit() != GLEW_OK)
-        std::cerr << ">>> Failed to initialize GLEW" << std::endl;
+    {
+        STARTUP_SCOPE("initialize GLEW");
+        glewExperimental = GL_TRUE;
+        if (glewInit() != GLEW_OK)
+            std::cerr << ">>> Failed to initialize GLEW" << std::endl;
+    }
 
     // get current OpenGL version
     const GLubyte* STR_RENDERER = glGetString(GL_RENDERER);
@@ -89,60 +154,58 @@ int main(int argc, char* argv[]) {
     glfwSwapInterval(1);
 
     // set initial viewport size
-    glViewport(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+    GLState::setViewport(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
 
     // enable back face culling
-    glCullFace(GL_BACK);
+    GLState::setCullFace(GL_BACK);
 
     // enable depth test
-    glEnable(GL_DEPTH_TEST);
-    glDepthFunc(GL_LESS);
+    GLState::setCapability(GL_DEPTH_TEST, true);
+    GLState::setDepthFunc(GL_LESS);
 
     // enable blending for transparency support
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    GLState::setCapability(GL_BLEND, true);
+    GLState::setBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
     // set up callbacks
     glfwSetFramebufferSizeCallback(window, callbackWindowResize);
-    glfwSetKeyCallback(window, callbackKeyboard);
-    glfwSetCursorPosCallback(window, callbackCursorPos);
-    glfwSetScrollCallback(window, callbackScroll);
+    glfwSetKeyCallback(window, callbackKeyboardLive);
+    glfwSetCursorPosCallback(window, callbackCursorPosLive);
+    glfwSetScrollCallback(window, callbackScrollLive);
 
     // delta time
     GLfloat deltaTime{ 0.0f };
     GLfloat frameCurrent{ 0.0f };
     GLfloat frameLast{ 0.0f };
 
-    // fps
-    GLfloat fpsDelta{ 0.0 };
-    GLfloat fpsUpdate{ 0.0f };
-    GLuint framesRendered{ 0 };
+    // load shaders, textures and scene before the first frame
+    {
+        STARTUP_SCOPE("Renderer::Renderer");
+        Renderer::get();
+    }
 
-    // initialize rand seed
-    srand(static_cast<GLuint>(glfwGetTime()));
+    // a replay renders the same workload as the recording: shadow quality
+    // must not follow the load of this machine
+    if (Recorder::get().isReplaying() && Renderer::get().isShadowBudgetEnabled())
+        Renderer::get().toggleShadowBudget();
+
+    // the first frame is the last startup step
+    bool startupReported{ false };
+    GLdouble firstFrameStart = StartupReport::getElapsedTime();
+    StartupReport::beginStep();
 
     // main loop
     while (!glfwWindowShouldClose(window)) {
+        PROFILE_ZONE("frame");
+
         // get delta time since last frame
         frameCurrent = static_cast<GLfloat>(glfwGetTime());
         deltaTime = std::min(frameCurrent - frameLast, 1.0f/60.0f);
         frameLast = frameCurrent;
 
-        // display framerate in window title
-        ++framesRendered;
-        fpsDelta = frameCurrent - fpsUpdate;
-        if (fpsDelta >= 1.0f) {
-            GLuint fps = static_cast<GLuint>(
-                static_cast<GLfloat>(framesRendered) / fpsDelta);
-
-            std::stringstream ss;
-            ss << WINDOW_TITLE << " - FPS: " << fps;
-            glfwSetWindowTitle(window, ss.str().c_str());
+        // record frame time, or substitute recorded one
+        deltaTime = Recorder::get().beginFrame(deltaTime);
 
-            fpsUpdate = frameCurrent;
-            framesRendered = 0;
-        }
-        
         // adjust camera move speed
         Camera::get().setSpeedCurrent(Camera::get().getSpeed()
             * deltaTime);
@@ -157,8 +220,22 @@ int main(int argc, char* argv[]) {
         // swap buffers and poll for events
         glfwSwapBuffers(window);
         glfwPollEvents();
+        Recorder::get().replayEvents(window);
+
+        // report startup time once the first frame is presented
+        if (!startupReported) {
+            StartupReport::endStep("first frame",
+                StartupReport::getElapsedTime() - firstFrameStart);
+            StartupReport::print();
+            if (!startupReport.empty())
+                StartupReport::writeJSON(startupReport);
+            startupReported = true;
+        }
     }
 
+    // flush recording
+    Recorder::get().stop();
+
     // terminate GLFW
     glfwTerminate();
 
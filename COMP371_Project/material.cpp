@@ -8,6 +8,21 @@ void Material::toggleTextures() {
     s_texturesEnabled = !s_texturesEnabled;
 }
 
+void Material::bind() const {
+    // bind textures only, for shaders without material uniforms
+    GLState::activateTextureUnit(m_diffuseUnit);
+    if (s_texturesEnabled)
+        GLState::bindTexture(GL_TEXTURE_2D, m_diffuse);
+    else
+        GLState::bindTexture(GL_TEXTURE_2D, NULL);
+
+    GLState::activateTextureUnit(m_specularUnit);
+    if (s_texturesEnabled)
+        GLState::bindTexture(GL_TEXTURE_2D, m_specular);
+    else
+        GLState::bindTexture(GL_TEXTURE_2D, NULL);
+}
+
 void Material::free() const {
     // free textures
     if (m_diffuse)
@@ -18,20 +33,9 @@ void Material::free() const {
 
 void Material::use(Shader* shader) const {
     // binds textures and sets shader uniforms
-    Shader::useProgram(shader->getProgramID());
-    shader->setUniformFloat(UNIFORM_MATERIAL_SHININESS, m_shininess);
-
-    Shader::activateTextureUnit(m_diffuseUnit);
-    if (s_texturesEnabled)
-        Shader::bind2DTexture(m_diffuse);
-    else
-        Shader::bind2DTexture(NULL);
-    shader->setUniformUInt(UNIFORM_MATERIAL_DIFFUSE, m_diffuseIndex);
-
-    Shader::activateTextureUnit(m_specularUnit);
-    if (s_texturesEnabled)
-        Shader::bind2DTexture(m_specular);
-    else
-        Shader::bind2DTexture(NULL);
-    shader->setUniformUInt(UNIFORM_MATERIAL_SPECULAR, m_specularIndex);
+    GLState::useProgram(shader->getProgramID());
+    shader->setUniform(UNIFORM_MATERIAL_SHININESS, m_shininess);
+    shader->setUniform(UNIFORM_MATERIAL_DIFFUSE, m_diffuseIndex);
+    shader->setUniform(UNIFORM_MATERIAL_SPECULAR, m_specularIndex);
+    bind();
 }
\ No newline at end of file
@@ -54,6 +54,7 @@ public:
 
     // utilities
     static void toggleTextures();
+    void bind() const;
     void free() const;
     void use(Shader* shader) const;
 
@@ -0,0 +1,33 @@
+#ifndef MESH_H
+#define MESH_H
+
+// GLEW
+#include <gl/glew.h>
+
+// C++ standard library headers
+#include <vector>
+
+// vertex and index formats of a mesh built by MeshBuilder, used when
+// pointing shader attributes at its buffers and drawing it
+struct MeshLayout {
+public:
+    GLenum m_positionType;
+    GLint m_positionComponents;
+    GLsizei m_positionStride;
+    GLenum m_indexType;
+};
+
+// indexed mesh data ready to be buffered: a position stream, an attribute
+// stream (packed normals and texture coordinates, empty for position-only
+// meshes) and triangle indices
+struct Mesh {
+public:
+    MeshLayout m_layout;
+    std::vector<GLubyte> m_positions;
+    std::vector<GLubyte> m_attributes;
+    std::vector<GLubyte> m_indices;
+    GLuint m_vertexCount;
+    GLuint m_indexCount;
+};
+
+#endif // !MESH_H
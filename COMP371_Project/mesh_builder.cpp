@@ -0,0 +1,275 @@
+#include "mesh_builder.h"
+
+Mesh MeshBuilder::build(const GLfloat vertices[],
+    GLuint verticesSize,
+    GLuint components,
+    bool halfPositions,
+    const GLuint indices[],
+    GLuint indicesSize) {
+    GLuint vertexCount = verticesSize / (components * sizeof(GLfloat));
+
+    // triangle list, raw vertices taken in order when not indexed
+    std::vector<GLuint> triangles;
+    if (indices)
+        triangles.assign(indices, indices + indicesSize / sizeof(GLuint));
+    else {
+        triangles.resize(vertexCount);
+        for (GLuint i{ 0 }; i != vertexCount; ++i)
+            triangles[i] = i;
+    }
+
+    // merge vertices that pack to the same data
+    std::map<PackedVertex, GLuint> unique;
+    std::vector<PackedVertex> packed;
+    std::vector<GLuint> merged(vertexCount);
+    for (GLuint i{ 0 }; i != vertexCount; ++i) {
+        PackedVertex vertex{ packVertex(&vertices[i * components],
+            components,
+            halfPositions) };
+        auto it = unique.find(vertex);
+        if (it == unique.end()) {
+            it = unique.emplace(vertex,
+                static_cast<GLuint>(packed.size())).first;
+            packed.push_back(vertex);
+        }
+        merged[i] = it->second;
+    }
+    for (GLuint& index : triangles)
+        index = merged[index];
+
+    // reorder triangles for cache reuse, then renumber vertices in the
+    // order they are first fetched (unreferenced vertices are dropped)
+    triangles = optimizeCache(triangles,
+        static_cast<GLuint>(packed.size()));
+
+    const GLuint unused{ static_cast<GLuint>(-1) };
+    std::vector<GLuint> order(packed.size(), unused);
+    GLuint next{ 0 };
+    for (GLuint& index : triangles) {
+        if (order[index] == unused)
+            order[index] = next++;
+        index = order[index];
+    }
+    std::vector<PackedVertex> sorted(next);
+    for (GLuint i{ 0 }; i != packed.size(); ++i)
+        if (order[i] != unused)
+            sorted[order[i]] = packed[i];
+
+    // layout
+    Mesh mesh;
+    if (halfPositions) {
+        mesh.m_layout.m_positionType = GL_HALF_FLOAT;
+        mesh.m_layout.m_positionComponents = 4;
+        mesh.m_layout.m_positionStride = 4 * sizeof(GLhalf);
+    }
+    else {
+        mesh.m_layout.m_positionType = GL_FLOAT;
+        mesh.m_layout.m_positionComponents = 3;
+        mesh.m_layout.m_positionStride = 3 * sizeof(GLfloat);
+    }
+    mesh.m_layout.m_indexType = next <= 0x10000
+        ? GL_UNSIGNED_SHORT
+        : GL_UNSIGNED_INT;
+    mesh.m_vertexCount = next;
+    mesh.m_indexCount = static_cast<GLuint>(triangles.size());
+
+    // vertex streams
+    for (const PackedVertex& vertex : sorted) {
+        appendBytes(mesh.m_positions,
+            &vertex[0],
+            mesh.m_layout.m_positionStride);
+        if (components == VERTEX_COMPONENTS)
+            appendBytes(mesh.m_attributes,
+                &vertex[3],
+                VERTEX_ATTRIBUTE_STRIDE);
+    }
+
+    // indices, 16 bits wide whenever they fit
+    for (GLuint index : triangles) {
+        if (mesh.m_layout.m_indexType == GL_UNSIGNED_SHORT) {
+            GLushort shortIndex{ static_cast<GLushort>(index) };
+            appendBytes(mesh.m_indices, &shortIndex, sizeof(GLushort));
+        }
+        else
+            appendBytes(mesh.m_indices, &index, sizeof(GLuint));
+    }
+
+    return mesh;
+}
+
+void MeshBuilder::upload(const Mesh& mesh,
+    GLuint positionVBO,
+    GLuint attributeVBO,
+    GLuint EBO) {
+    // buffer mesh streams, the element array buffer is recorded in the
+    // bound vertex array object
+    GLState::bindBuffer(GL_ARRAY_BUFFER, positionVBO);
+    glBufferData(GL_ARRAY_BUFFER,
+        mesh.m_positions.size(),
+        mesh.m_positions.data(),
+        GL_STATIC_DRAW);
+
+    if (attributeVBO != 0) {
+        GLState::bindBuffer(GL_ARRAY_BUFFER, attributeVBO);
+        glBufferData(GL_ARRAY_BUFFER,
+            mesh.m_attributes.size(),
+            mesh.m_attributes.data(),
+            GL_STATIC_DRAW);
+    }
+
+    GLState::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+        mesh.m_indices.size(),
+        mesh.m_indices.data(),
+        GL_STATIC_DRAW);
+}
+
+void MeshBuilder::appendBytes(std::vector<GLubyte>& bytes,
+    const void* data,
+    size_t size) {
+    // append raw bytes to a buffer stream
+    size_t offset{ bytes.size() };
+    bytes.resize(offset + size);
+    std::memcpy(&bytes[offset], data, size);
+}
+
+MeshBuilder::PackedVertex MeshBuilder::packVertex(const GLfloat vertex[],
+    GLuint components,
+    bool halfPositions) {
+    PackedVertex packed{};
+
+    // position: 32-bit float bits, or four half floats (w = 1)
+    if (halfPositions) {
+        glm::uint64 position{ glm::packHalf4x16(
+            glm::vec4(vertex[0], vertex[1], vertex[2], 1.0f)) };
+        std::memcpy(&packed[0], &position, sizeof(glm::uint64));
+    }
+    else
+        std::memcpy(&packed[0], vertex, 3 * sizeof(GLfloat));
+
+    // normal as signed normalized 10-10-10-2, texture coordinates as half
+    // floats
+    if (components == VERTEX_COMPONENTS) {
+        packed[3] = glm::packSnorm3x10_1x2(
+            glm::vec4(vertex[3], vertex[4], vertex[5], 0.0f));
+        packed[4] = glm::packHalf2x16(glm::vec2(vertex[6], vertex[7]));
+    }
+
+    return packed;
+}
+
+std::vector<GLuint> MeshBuilder::optimizeCache(const std::vector<GLuint>& indices,
+    GLuint vertexCount) {
+    GLuint triangleCount{ static_cast<GLuint>(indices.size() / 3) };
+
+    // triangles still to be emitted around each vertex
+    std::vector<std::vector<GLuint>> vertexTriangles(vertexCount);
+    for (GLuint t{ 0 }; t != triangleCount; ++t)
+        for (GLuint k{ 0 }; k != 3; ++k)
+            vertexTriangles[indices[3 * t + k]].push_back(t);
+
+    // initial vertex and triangle scores, nothing cached yet
+    std::vector<GLint> cachePositions(vertexCount, -1);
+    std::vector<GLfloat> vertexScores(vertexCount);
+    for (GLuint v{ 0 }; v != vertexCount; ++v)
+        vertexScores[v] = scoreVertex(-1,
+            static_cast<GLuint>(vertexTriangles[v].size()));
+
+    std::vector<GLfloat> triangleScores(triangleCount);
+    std::vector<bool> emitted(triangleCount, false);
+    for (GLuint t{ 0 }; t != triangleCount; ++t)
+        triangleScores[t] = vertexScores[indices[3 * t]]
+            + vertexScores[indices[3 * t + 1]]
+            + vertexScores[indices[3 * t + 2]];
+
+    // greedily emit the best-scoring triangle touching the cache
+    std::vector<GLuint> result;
+    result.reserve(indices.size());
+    std::vector<GLuint> cache;
+    GLint best{ -1 };
+    for (GLuint n{ 0 }; n != triangleCount; ++n) {
+        // nothing cached to continue from, take the best triangle left
+        if (best < 0) {
+            GLfloat bestScore{ -1.0f };
+            for (GLuint t{ 0 }; t != triangleCount; ++t)
+                if (!emitted[t] && triangleScores[t] > bestScore) {
+                    bestScore = triangleScores[t];
+                    best = t;
+                }
+        }
+
+        // emit triangle, its vertices move to the front of the cache
+        emitted[best] = true;
+        std::vector<GLuint> nextCache;
+        for (GLuint k{ 0 }; k != 3; ++k) {
+            GLuint v{ indices[3 * best + k] };
+            result.push_back(v);
+            nextCache.push_back(v);
+
+            std::vector<GLuint>& triangles = vertexTriangles[v];
+            triangles.erase(std::find(triangles.begin(),
+                triangles.end(),
+                static_cast<GLuint>(best)));
+        }
+        for (GLuint v : cache)
+            if (std::find(nextCache.begin(), nextCache.begin() + 3, v)
+                == nextCache.begin() + 3)
+                nextCache.push_back(v);
+
+        // update cache positions and scores, including evicted vertices
+        for (GLuint i{ 0 }; i != nextCache.size(); ++i) {
+            GLuint v{ nextCache[i] };
+            cachePositions[v] = i < MESH_CACHE_SIZE
+                ? static_cast<GLint>(i)
+                : -1;
+            vertexScores[v] = scoreVertex(cachePositions[v],
+                static_cast<GLuint>(vertexTriangles[v].size()));
+        }
+
+        // rescore affected triangles, pick the next one among them
+        best = -1;
+        GLfloat bestScore{ -1.0f };
+        for (GLuint v : nextCache)
+            for (GLuint t : vertexTriangles[v]) {
+                triangleScores[t] = vertexScores[indices[3 * t]]
+                    + vertexScores[indices[3 * t + 1]]
+                    + vertexScores[indices[3 * t + 2]];
+                if (triangleScores[t] > bestScore) {
+                    bestScore = triangleScores[t];
+                    best = t;
+                }
+            }
+
+        if (nextCache.size() > MESH_CACHE_SIZE)
+            nextCache.resize(MESH_CACHE_SIZE);
+        cache.swap(nextCache);
+    }
+
+    return result;
+}
+
+GLfloat MeshBuilder::scoreVertex(GLint cachePosition,
+    GLuint remainingTriangles) {
+    // vertices without triangles left are never picked
+    if (remainingTriangles == 0)
+        return -1.0f;
+
+    // recently used vertices score higher, the last triangle's vertices get
+    // a fixed score so that strips do not reuse them right away
+    GLfloat score{ 0.0f };
+    if (cachePosition >= 0) {
+        if (cachePosition < 3)
+            score = MESH_LAST_TRIANGLE_SCORE;
+        else
+            score = std::pow(1.0f - (cachePosition - 3)
+                / static_cast<GLfloat>(MESH_CACHE_SIZE - 3),
+                MESH_CACHE_DECAY_POWER);
+    }
+
+    // vertices with few triangles left score higher, to finish them off
+    score += MESH_VALENCE_BOOST_SCALE
+        * std::pow(static_cast<GLfloat>(remainingTriangles),
+            -MESH_VALENCE_BOOST_POWER);
+
+    return score;
+}
@@ -0,0 +1,68 @@
+#ifndef MESH_BUILDER_H
+#define MESH_BUILDER_H
+
+// project headers
+#include "constants.h"
+#include "gl_state.h"
+#include "mesh.h"
+
+// GLEW
+#include <gl/glew.h>
+
+// GLM
+#include <glm/glm.hpp>
+#include <glm/gtc/packing.hpp>
+
+// C++ standard library headers
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <vector>
+
+// builds indexed triangle meshes out of raw float vertex arrays: identical
+// vertices are merged, triangles are reordered for post-transform cache
+// reuse (Forsyth's linear-speed optimizer), vertices are renumbered in
+// first-use order and attributes are packed (10-10-10-2 normals, half
+// texture coordinates, optionally half positions)
+class MeshBuilder {
+public:
+    MeshBuilder() = delete;
+    MeshBuilder(const MeshBuilder& builder) = delete;
+    MeshBuilder(MeshBuilder&& builder) = delete;
+    MeshBuilder& operator=(MeshBuilder& builder) = delete;
+
+    // building (components is VERTEX_COMPONENTS for position, normal and
+    // texture coordinates, or VERTEX_POSITION_COMPONENTS for positions only)
+    static Mesh build(const GLfloat vertices[],
+        GLuint verticesSize,
+        GLuint components,
+        bool halfPositions,
+        const GLuint indices[] = nullptr,
+        GLuint indicesSize = 0);
+
+    // uploading
+    static void upload(const Mesh& mesh,
+        GLuint positionVBO,
+        GLuint attributeVBO,
+        GLuint EBO);
+
+private:
+    // packed vertex used to merge duplicates: position bits, normal and
+    // texture coordinates
+    typedef std::array<GLuint, 5> PackedVertex;
+
+    static void appendBytes(std::vector<GLubyte>& bytes,
+        const void* data,
+        size_t size);
+    static PackedVertex packVertex(const GLfloat vertex[],
+        GLuint components,
+        bool halfPositions);
+    static std::vector<GLuint> optimizeCache(const std::vector<GLuint>& indices,
+        GLuint vertexCount);
+    static GLfloat scoreVertex(GLint cachePosition,
+        GLuint remainingTriangles);
+};
+
+#endif // !MESH_BUILDER_H
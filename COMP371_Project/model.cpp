@@ -274,22 +274,6 @@ void Model::removeJoint(Joint* joint) {
         m_joints.erase(it);
 }
 
-void Model::setColorShaderAttributes(Shader* shader) const {
-    // set shader attributes
-    for (ModelHierarchy::const_iterator it{ m_hierarchy.begin() };
-        it != m_hierarchy.end();
-        ++it)
-        it->first->setColorShaderAttributes(shader);
-}
-
-void Model::setDepthShaderAttributes(Shader* shader) const {
-    // set shader attributes
-    for (ModelHierarchy::const_iterator it{ m_hierarchy.begin() };
-        it != m_hierarchy.end();
-        ++it)
-        it->first->setDepthShaderAttributes(shader);
-}
-
 void Model::clampPosition() {
     // clamp model position (restrain for collisions)
     if (m_position.x > (POSITION_MAX - 5.0f) / m_scale)
@@ -82,8 +82,6 @@ public:
     void detach(RenderedEntity* toDetach,
         RenderedEntity* detachFrom);
     void removeJoint(Joint* joint);
-    void setColorShaderAttributes(Shader* shader) const;
-    void setDepthShaderAttributes(Shader* shader) const;
 
 private:
     void clampPosition();
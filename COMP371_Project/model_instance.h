@@ -0,0 +1,14 @@
+#ifndef MODEL_INSTANCE_H
+#define MODEL_INSTANCE_H
+
+// GLM
+#include <glm/glm.hpp>
+
+// per-instance data of a model entity, laid out as in the instance buffer
+struct ModelInstance {
+public:
+    glm::mat4 m_modelMatrix;
+    glm::vec4 m_color;
+};
+
+#endif // !MODEL_INSTANCE_H
\ No newline at end of file
@@ -0,0 +1,170 @@
+#include "overdraw_map.h"
+
+GLuint OverdrawMap::getCountTextureID() const {
+    // return count texture id
+    return m_countTextureID;
+}
+
+GLuint OverdrawMap::getFBOID() const {
+    // return FBO id
+    return m_FBO;
+}
+
+void OverdrawMap::begin(GLuint width,
+    GLuint height) {
+    // match count texture to viewport
+    if (width != m_width || height != m_height)
+        resize(width, height);
+
+    // bind count framebuffer, cleared by the pass that follows
+    GLState::bindFramebuffer(m_FBO);
+
+    // every fragment adds to the count, whether it is occluded or not
+    GLState::setBlendFunc(GL_ONE, GL_ONE);
+    GLState::setDepthFunc(GL_ALWAYS);
+    GLState::setDepthMask(GL_FALSE);
+}
+
+void OverdrawMap::end() const {
+    // restore default blending and depth state
+    GLState::setBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    GLState::setDepthFunc(GL_LESS);
+    GLState::setDepthMask(GL_TRUE);
+
+    // unbind framebuffer
+    GLState::bindFramebuffer(NULL);
+}
+
+void OverdrawMap::free() const {
+    // free resources
+    glDeleteVertexArrays(1, &m_VAO);
+    glDeleteBuffers(1, &m_VBO);
+    glDeleteBuffers(1, &m_EBO);
+    glDeleteFramebuffers(1, &m_FBO);
+    glDeleteTextures(1, &m_countTextureID);
+}
+
+void OverdrawMap::render() const {
+    // set texture properties
+    GLState::useProgram(m_shader.getProgramID());
+    GLState::activateTextureUnit(GL_TEXTURE0);
+    GLState::bindTexture(GL_TEXTURE_2D, m_countTextureID);
+
+    // render false colors over the whole viewport
+    GLState::setCapability(GL_DEPTH_TEST, false);
+    GLState::bindVertexArray(m_VAO);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+    GLState::setCapability(GL_DEPTH_TEST, true);
+}
+
+void OverdrawMap::initialize() {
+    // generate framebuffer and count texture, sized on first use
+    glGenFramebuffers(1, &m_FBO);
+    glGenTextures(1, &m_countTextureID);
+
+    // set shader uniforms
+    GLState::useProgram(m_shader.getProgramID());
+    m_shader.setUniform(UNIFORM_OVERDRAW_TEXTURE,
+        0);
+    m_shader.setUniform(UNIFORM_OVERDRAW_MAX,
+        OVERDRAW_COUNT_MAX);
+}
+
+void OverdrawMap::initializeQuad() {
+    // vertex positions for framebuffer quad
+    GLfloat vertices[] = {
+        // position    // texture
+        -1.0f, 1.0f,   0.0f, 1.0f,
+        -1.0f, -1.0f,  0.0f, 0.0f,
+        1.0f, -1.0f,   1.0f, 0.0f,
+        1.0f, 1.0f,    1.0f, 1.0f
+    };
+
+    GLuint indices[] = {
+        0, 1, 2,
+        0, 2, 3
+    };
+
+    // generate and bind vertex array object
+    glGenVertexArrays(1, &m_VAO);
+    GLState::bindVertexArray(m_VAO);
+
+    // generate and bind vertex buffer object, buffer data
+    glGenBuffers(1, &m_VBO);
+    GLState::bindBuffer(GL_ARRAY_BUFFER, m_VBO);
+    glBufferData(GL_ARRAY_BUFFER,
+        sizeof(vertices),
+        vertices,
+        GL_STATIC_DRAW);
+
+    // generate and bind element array buffer object, buffer data
+    glGenBuffers(1, &m_EBO);
+    GLState::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+        sizeof(indices),
+        indices,
+        GL_STATIC_DRAW);
+
+    // vertex attributes
+    GLuint positionLocation = glGetAttribLocation(m_shader.getProgramID(),
+        ATTRIBUTE_POSITION.c_str());
+    glVertexAttribPointer(positionLocation,
+        2,
+        GL_FLOAT,
+        GL_FALSE,
+        4 * sizeof(GLfloat),
+        (void*)0);
+    glEnableVertexAttribArray(positionLocation);
+    GLuint textureLocation = glGetAttribLocation(m_shader.getProgramID(),
+        ATTRIBUTE_TEXTURE.c_str());
+    glVertexAttribPointer(textureLocation,
+        2,
+        GL_FLOAT,
+        GL_FALSE,
+        4 * sizeof(GLfloat),
+        (void*)(2 * sizeof(GLfloat)));
+    glEnableVertexAttribArray(textureLocation);
+}
+
+void OverdrawMap::resize(GLuint width,
+    GLuint height) {
+    // allocate half float counts, exact up to 2048 fragments per pixel
+    GLState::activateTextureUnit(GL_TEXTURE0);
+    GLState::bindTexture(GL_TEXTURE_2D, m_countTextureID);
+    glTexImage2D(GL_TEXTURE_2D,
+        0,
+        GL_R16F,
+        width,
+        height,
+        0,
+        GL_RED,
+        GL_FLOAT,
+        NULL);
+
+    // set texture filtering parameters
+    glTexParameteri(GL_TEXTURE_2D,
+        GL_TEXTURE_MIN_FILTER,
+        GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D,
+        GL_TEXTURE_MAG_FILTER,
+        GL_NEAREST);
+
+    // use texture as color attachment, no depth buffer is needed
+    GLState::bindFramebuffer(m_FBO);
+    glFramebufferTexture(GL_FRAMEBUFFER,
+        GL_COLOR_ATTACHMENT0,
+        m_countTextureID,
+        0);
+
+    // check the framebuffer for problems
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER)
+        != GL_FRAMEBUFFER_COMPLETE)
+        std::cout << ">>> Overdraw framebuffer incomplete."
+        << std::endl << std::endl;
+
+    // unbind framebuffer
+    GLState::bindFramebuffer(NULL);
+
+    m_width = width;
+    m_height = height;
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+#ifndef OVERDRAW_MAP_H
+#define OVERDRAW_MAP_H
+
+// project headers
+#include "constants.h"
+#include "shader.h"
+
+// GLEW
+#include <gl/glew.h>
+
+// counts fragments per pixel: the scene is rendered with additive blending
+// into a float target while shaders output 1 per fragment, and the counts
+// are then shown in false colors
+class OverdrawMap {
+public:
+    OverdrawMap() {
+        initialize();
+        initializeQuad();
+    }
+
+    // getters
+    GLuint getCountTextureID() const;
+    GLuint getFBOID() const;
+
+    // utilities
+    void begin(GLuint width,
+        GLuint height);
+    void end() const;
+    void free() const;
+    void render() const;
+
+private:
+    void initialize();
+    void initializeQuad();
+
+    // utilities
+    void resize(GLuint width,
+        GLuint height);
+
+    Shader m_shader{ PATH_VERTEX_OVERDRAW,
+        PATH_FRAGMENT_OVERDRAW };
+    GLuint m_VAO;
+    GLuint m_VBO;
+    GLuint m_EBO;
+    GLuint m_FBO;
+    GLuint m_countTextureID;
+    GLuint m_width{ 0 };
+    GLuint m_height{ 0 };
+};
+
+#endif // !OVERDRAW_MAP_H
\ No newline at end of file
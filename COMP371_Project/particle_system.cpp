@@ -0,0 +1,51 @@
+#include "particle_system.h"
+
+GLuint ParticleSystem::update(std::vector<Particle*>& particles,
+    GLfloat deltaTime,
+    const glm::vec3& cameraPosition,
+    glm::vec3 positions[]) {
+    // respawn particles that died or fell below the ground
+    for (GLuint i{ 0 }; i != particles.size(); ++i) {
+        if (particles.at(i)->m_life < 0.0f
+            || particles.at(i)->m_position.y < 0.0f) {
+            particles.at(i)->m_life = 10.0f;
+            particles.at(i)->m_position = glm::vec3(
+                static_cast<GLfloat>(rand() % GRID_SIZE - POSITION_MAX),
+                LIGHT_POSITION_NOON.y + static_cast<GLfloat>(rand() % 65),
+                static_cast<GLfloat>(rand() % GRID_SIZE - POSITION_MAX));
+        }
+    }
+
+    // advance live particles
+    GLuint particleCount = 0;
+    for (GLuint i{ 0 }; i != particles.size(); ++i) {
+        Particle* p = particles.at(i);
+
+        if (p->m_life > 0.0f) {
+            p->m_life -= deltaTime;
+
+            if (p->m_life > 0.0f) {
+                p->m_velocity = glm::vec3(0.0f,
+                    -9.81f,
+                    0.0f)
+                    * 100.0f
+                    * deltaTime;
+                p->m_position.y += p->m_velocity.y * deltaTime;
+
+                p->m_distanceToCamera = glm::length(p->m_position
+                    - cameraPosition);
+
+                positions[particleCount].x = p->m_position.x;
+                positions[particleCount].y = p->m_position.y;
+                positions[particleCount].z = p->m_position.z;
+            }
+
+            else
+                p->m_distanceToCamera = -1.0f;
+
+            ++particleCount;
+        }
+    }
+
+    return particleCount;
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+#ifndef PARTICLE_SYSTEM_H
+#define PARTICLE_SYSTEM_H
+
+// project headers
+#include "constants.h"
+#include "particle.h"
+
+// GLEW
+#include <gl/glew.h>
+
+// GLM
+#include <glm/glm.hpp>
+
+// C++ standard library headers
+#include <stdlib.h>
+#include <vector>
+
+class ParticleSystem {
+public:
+    ParticleSystem() = delete;
+    ParticleSystem(const ParticleSystem& system) = delete;
+    ParticleSystem(ParticleSystem&& system) = delete;
+    ParticleSystem& operator=(ParticleSystem& system) = delete;
+
+    // simulation (respawns dead particles, advances live ones and writes
+    // their positions to the given array, returns number of live particles)
+    static GLuint update(std::vector<Particle*>& particles,
+        GLfloat deltaTime,
+        const glm::vec3& cameraPosition,
+        glm::vec3 positions[]);
+};
+
+#endif // !PARTICLE_SYSTEM_H
\ No newline at end of file
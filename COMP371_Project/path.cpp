@@ -15,6 +15,8 @@ void Path::setSpeed(GLfloat speed) {
 
 void Path::traverse(Model* model,
     GLfloat deltaTime) {
+    PROFILE_ZONE("Path::traverse");
+
     // update current time
     m_timeTraveled += m_speed * deltaTime;
 
@@ -4,6 +4,7 @@
 // project headers
 #include "model.h"
 #include "path_step.h"
+#include "profiler.h"
 
 // C++ standard library headers
 #include <vector>
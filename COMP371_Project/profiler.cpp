@@ -0,0 +1,109 @@
+#include "profiler.h"
+
+// C++ standard library headers
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+// all timestamps are relative to program start
+const Profiler::Clock::time_point Profiler::s_epoch = Profiler::Clock::now();
+
+// buffers of every thread that recorded a zone (registration only is locked)
+std::vector<Profiler::ThreadBuffer*> Profiler::s_buffers;
+std::mutex Profiler::s_buffersMutex;
+
+// profiling enabled by default
+std::atomic<bool> Profiler::s_enabled{ true };
+
+GLint64 Profiler::getTime() {
+    // get nanoseconds elapsed since profiler epoch
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        Clock::now() - s_epoch).count();
+}
+
+bool Profiler::isEnabled() {
+    // get whether zones are recorded
+    return s_enabled.load(std::memory_order_relaxed);
+}
+
+void Profiler::setEnabled(bool value) {
+    // set whether zones should be recorded
+    s_enabled.store(value, std::memory_order_relaxed);
+}
+
+void Profiler::record(const char* name,
+    GLint64 start,
+    GLint64 end) {
+    if (!isEnabled())
+        return;
+
+    // write event into the calling thread's ring, overwriting the oldest
+    ThreadBuffer* buffer = getThreadBuffer();
+    GLuint64 head = buffer->m_head.load(std::memory_order_relaxed);
+    Event& event = buffer->m_events[head % PROFILER_CAPACITY];
+    event.name = name;
+    event.start = start;
+    event.duration = end - start;
+    buffer->m_head.store(head + 1, std::memory_order_release);
+}
+
+bool Profiler::writeTrace(const std::string& path) {
+    // write recorded zones as Chrome trace events (complete events, in
+    // microseconds), the most recent PROFILER_CAPACITY per thread
+    std::ofstream file(path);
+    if (!file) {
+        std::cerr << ">>> Failed to write profiler trace: " << path
+            << std::endl;
+
+        return false;
+    }
+
+    std::vector<ThreadBuffer*> buffers;
+    {
+        std::lock_guard<std::mutex> lock(s_buffersMutex);
+        buffers = s_buffers;
+    }
+
+    GLuint64 eventCount{ 0 };
+    bool first{ true };
+    file << "{\"traceEvents\":[" << std::endl << std::fixed
+        << std::setprecision(3);
+    for (std::vector<ThreadBuffer*>::const_iterator it{ buffers.begin() };
+        it != buffers.end();
+        ++it) {
+        GLuint64 head = (*it)->m_head.load(std::memory_order_acquire);
+        GLuint64 tail = head > PROFILER_CAPACITY
+            ? head - PROFILER_CAPACITY
+            : 0;
+
+        for (GLuint64 i{ tail }; i != head; ++i) {
+            const Event& event = (*it)->m_events[i % PROFILER_CAPACITY];
+            file << (first ? "" : ",\n")
+                << "{\"name\":\"" << event.name
+                << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << (*it)->m_id
+                << ",\"ts\":" << event.start / 1000.0
+                << ",\"dur\":" << event.duration / 1000.0 << "}";
+            first = false;
+        }
+        eventCount += head - tail;
+    }
+    file << std::endl << "]}" << std::endl;
+
+    std::cout << "Profiler trace written to " << path << " ("
+        << eventCount << " zones)" << std::endl;
+
+    return true;
+}
+
+Profiler::ThreadBuffer* Profiler::getThreadBuffer() {
+    // create and register the calling thread's buffer on first use
+    thread_local ThreadBuffer* t_buffer = nullptr;
+    if (!t_buffer) {
+        std::lock_guard<std::mutex> lock(s_buffersMutex);
+        t_buffer = new ThreadBuffer(s_buffers.size() + 1);
+        s_buffers.push_back(t_buffer);
+    }
+
+    return t_buffer;
+}
\ No newline at end of file
@@ -0,0 +1,99 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+// project headers
+#include "constants.h"
+
+// GLEW
+#include <gl/glew.h>
+
+// C++ standard library headers
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// scoped CPU zone, e.g. PROFILE_ZONE("Renderer::render"), names must be
+// string literals (only the pointer is stored)
+#ifdef DISABLE_PROFILER
+#define PROFILE_ZONE(name)
+#else
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_ZONE(name) \
+    ProfileZone PROFILE_CONCAT(profileZone, __LINE__)(name)
+#endif
+
+// records completed zones into per-thread ring buffers and exports them as
+// a Chrome trace (chrome://tracing or ui.perfetto.dev)
+class Profiler {
+public:
+    Profiler() = delete;
+    Profiler(const Profiler& profiler) = delete;
+    Profiler(Profiler&& profiler) = delete;
+    Profiler& operator=(Profiler& profiler) = delete;
+
+    // getters
+    static GLint64 getTime();
+    static bool isEnabled();
+
+    // setters
+    static void setEnabled(bool value);
+
+    // utilities
+    static void record(const char* name,
+        GLint64 start,
+        GLint64 end);
+    static bool writeTrace(const std::string& path);
+
+private:
+    // completed zone (times in nanoseconds since profiler epoch)
+    struct Event {
+        const char* name;
+        GLint64 start;
+        GLint64 duration;
+    };
+
+    // single-writer ring of events, the owning thread only publishes the
+    // head index so readers never need to lock
+    struct ThreadBuffer {
+        ThreadBuffer(GLuint id)
+            : m_events{ new Event[PROFILER_CAPACITY] },
+            m_id{ id } {}
+
+        Event* m_events;
+        std::atomic<GLuint64> m_head{ 0 };
+        GLuint m_id;
+    };
+
+    typedef std::chrono::steady_clock Clock;
+
+    static ThreadBuffer* getThreadBuffer();
+
+    static const Clock::time_point s_epoch;
+    static std::vector<ThreadBuffer*> s_buffers;
+    static std::mutex s_buffersMutex;
+    static std::atomic<bool> s_enabled;
+};
+
+// RAII zone marker, records its lifetime on destruction
+class ProfileZone {
+public:
+    ProfileZone() = delete;
+    ProfileZone(const char* name)
+        : m_name{ name },
+        m_start{ Profiler::getTime() } {}
+    ProfileZone(const ProfileZone& zone) = delete;
+    ProfileZone(ProfileZone&& zone) = delete;
+    ProfileZone& operator=(ProfileZone& zone) = delete;
+    ~ProfileZone() {
+        Profiler::record(m_name, m_start, Profiler::getTime());
+    }
+
+private:
+    const char* m_name;
+    GLint64 m_start;
+};
+
+#endif // !PROFILER_H
\ No newline at end of file
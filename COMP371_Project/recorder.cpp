@@ -0,0 +1,252 @@
+#include "recorder.h"
+
+// C++ standard library headers
+#include <algorithm>
+#include <iostream>
+#include <stdlib.h>
+#include <time.h>
+
+Recorder::Recorder()
+    : m_seed{ static_cast<GLuint>(time(NULL)) } {}
+
+Recorder& Recorder::get() {
+    // create or return singleton instance
+    static Recorder s_instance;
+
+    return s_instance;
+}
+
+Replay::Mode Recorder::getMode() const {
+    // get current mode
+    return m_mode;
+}
+
+GLuint Recorder::getMouseButtons() const {
+    // get mouse button mask of the last replayed cursor event
+    return m_mouseButtons;
+}
+
+GLuint Recorder::getSeed() const {
+    // get seed the scene is initialized with
+    return m_seed;
+}
+
+bool Recorder::isRecording() const {
+    // get whether input is being recorded
+    return m_mode == Replay::RECORD;
+}
+
+bool Recorder::isReplaying() const {
+    // get whether input is being replayed
+    return m_mode == Replay::REPLAY;
+}
+
+void Recorder::setCallbacks(GLFWkeyfun keyboard,
+    GLFWcursorposfun cursor,
+    GLFWscrollfun scroll) {
+    // set handlers replayed events are dispatched to
+    m_callbackKeyboard = keyboard;
+    m_callbackCursor = cursor;
+    m_callbackScroll = scroll;
+}
+
+void Recorder::setSeed(GLuint seed) {
+    // set seed the scene is initialized with (a replay uses the recorded one)
+    m_seed = seed;
+}
+
+GLfloat Recorder::beginFrame(GLfloat deltaTime) {
+    // reseed every frame so that a replay stays in step with the recording
+    // even if the number of rand() calls per frame changes
+    if (m_mode == Replay::RECORD) {
+        GLuint seed = static_cast<GLuint>(rand());
+        srand(seed);
+        write(static_cast<GLubyte>(Replay::FRAME));
+        write(deltaTime);
+        write(seed);
+        ++m_frames;
+
+        return deltaTime;
+    }
+
+    // use recorded frame time and seed instead
+    if (m_mode == Replay::REPLAY) {
+        GLubyte tag;
+        GLfloat recordedDeltaTime;
+        GLuint seed;
+        if (read(tag)
+            && tag == Replay::FRAME
+            && read(recordedDeltaTime)
+            && read(seed)) {
+            srand(seed);
+            ++m_frames;
+
+            return recordedDeltaTime;
+        }
+
+        stop();
+    }
+
+    return deltaTime;
+}
+
+void Recorder::recordCursor(double posX,
+    double posY,
+    GLuint mouseButtons) {
+    // record cursor event along with the mouse buttons it was handled with
+    if (m_mode != Replay::RECORD)
+        return;
+
+    write(static_cast<GLubyte>(Replay::CURSOR));
+    write(posX);
+    write(posY);
+    write(static_cast<GLubyte>(mouseButtons));
+}
+
+void Recorder::recordKeyboard(int key,
+    int scanCode,
+    int action,
+    int mods) {
+    // record keyboard event
+    if (m_mode != Replay::RECORD)
+        return;
+
+    write(static_cast<GLubyte>(Replay::KEYBOARD));
+    write(static_cast<GLint>(key));
+    write(static_cast<GLint>(scanCode));
+    write(static_cast<GLint>(action));
+    write(static_cast<GLint>(mods));
+}
+
+void Recorder::recordScroll(double offX,
+    double offY) {
+    // record scroll event
+    if (m_mode != Replay::RECORD)
+        return;
+
+    write(static_cast<GLubyte>(Replay::SCROLL));
+    write(offX);
+    write(offY);
+}
+
+void Recorder::replayEvents(GLFWwindow* window) {
+    // dispatch events recorded after the current frame, up to the next one
+    while (m_mode == Replay::REPLAY) {
+        if (m_input.peek() == std::char_traits<char>::eof()) {
+            stop();
+            break;
+        }
+        if (m_input.peek() == Replay::FRAME)
+            break;
+
+        GLubyte tag;
+        read(tag);
+        switch (tag) {
+        case Replay::KEYBOARD: {
+            GLint key, scanCode, action, mods;
+            if (read(key) && read(scanCode) && read(action) && read(mods)
+                && m_callbackKeyboard)
+                m_callbackKeyboard(window, key, scanCode, action, mods);
+        }
+            break;
+        case Replay::CURSOR: {
+            double posX, posY;
+            GLubyte mouseButtons;
+            if (read(posX) && read(posY) && read(mouseButtons)) {
+                m_mouseButtons = mouseButtons;
+                if (m_callbackCursor)
+                    m_callbackCursor(window, posX, posY);
+            }
+        }
+            break;
+        case Replay::SCROLL: {
+            double offX, offY;
+            if (read(offX) && read(offY) && m_callbackScroll)
+                m_callbackScroll(window, offX, offY);
+        }
+            break;
+        default:
+            std::cerr << ">>> Corrupt replay log (unknown event "
+                << static_cast<GLuint>(tag) << ")" << std::endl;
+            stop();
+        }
+    }
+}
+
+bool Recorder::startRecording(const std::string& path) {
+    // open log and write header
+    stop();
+    m_output.open(path, std::ios::binary);
+    if (!m_output) {
+        std::cerr << ">>> Failed to open replay log for writing: " << path
+            << std::endl;
+
+        return false;
+    }
+
+    m_output.write(REPLAY_MAGIC, sizeof(REPLAY_MAGIC));
+    write(REPLAY_VERSION);
+    write(m_seed);
+    m_mode = Replay::RECORD;
+    m_frames = 0;
+    std::cout << "Recording input to " << path << " (seed " << m_seed << ")"
+        << std::endl;
+
+    return true;
+}
+
+bool Recorder::startReplay(const std::string& path) {
+    // open log and read header
+    stop();
+    m_input.open(path, std::ios::binary);
+    char magic[sizeof(REPLAY_MAGIC)];
+    GLuint version;
+    GLuint seed;
+    if (!m_input
+        || !m_input.read(magic, sizeof(magic))
+        || !std::equal(magic, magic + sizeof(magic), REPLAY_MAGIC)
+        || !read(version)
+        || version != REPLAY_VERSION
+        || !read(seed)) {
+        std::cerr << ">>> Failed to open replay log: " << path << std::endl;
+        m_input.close();
+
+        return false;
+    }
+
+    m_seed = seed;
+    m_mode = Replay::REPLAY;
+    m_frames = 0;
+    std::cout << "Replaying input from " << path << " (seed " << m_seed
+        << ")" << std::endl;
+
+    return true;
+}
+
+void Recorder::stop() {
+    // close log, live input takes over
+    if (m_mode == Replay::RECORD)
+        std::cout << "Recording stopped after " << m_frames << " frames"
+            << std::endl;
+    else if (m_mode == Replay::REPLAY)
+        std::cout << "Replay finished after " << m_frames << " frames"
+            << std::endl;
+
+    m_input.close();
+    m_output.close();
+    m_mode = Replay::OFF;
+    m_mouseButtons = 0;
+}
+
+template <typename T>
+bool Recorder::read(T& value) {
+    // read raw value from log
+    return static_cast<bool>(m_input.read(reinterpret_cast<char*>(&value),
+        sizeof(T)));
+}
+
+template <typename T>
+void Recorder::write(const T& value) {
+    // write raw value to log
+    m_output.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
\ No newline at end of file
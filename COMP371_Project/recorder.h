@@ -0,0 +1,76 @@
+#ifndef RECORDER_H
+#define RECORDER_H
+
+// project headers
+#include "constants.h"
+#include "enums.h"
+
+// GLEW
+#include <gl/glew.h>
+
+// GLFW
+#include <GLFW/glfw3.h>
+
+// C++ standard library headers
+#include <fstream>
+#include <string>
+
+// singleton, records input events, frame times and random seeds to a binary
+// log and plays them back frame for frame
+class Recorder {
+public:
+    Recorder(const Recorder& recorder) = delete;
+    Recorder(Recorder&& recorder) = delete;
+    Recorder& operator=(Recorder& recorder) = delete;
+    static Recorder& get();
+
+    // getters
+    Replay::Mode getMode() const;
+    GLuint getMouseButtons() const;
+    GLuint getSeed() const;
+    bool isRecording() const;
+    bool isReplaying() const;
+
+    // setters
+    void setCallbacks(GLFWkeyfun keyboard,
+        GLFWcursorposfun cursor,
+        GLFWscrollfun scroll);
+    void setSeed(GLuint seed);
+
+    // utilities
+    GLfloat beginFrame(GLfloat deltaTime);
+    void recordCursor(double posX,
+        double posY,
+        GLuint mouseButtons);
+    void recordKeyboard(int key,
+        int scanCode,
+        int action,
+        int mods);
+    void recordScroll(double offX,
+        double offY);
+    void replayEvents(GLFWwindow* window);
+    bool startRecording(const std::string& path);
+    bool startReplay(const std::string& path);
+    void stop();
+
+private:
+    Recorder();
+
+    template <typename T>
+    bool read(T& value);
+    template <typename T>
+    void write(const T& value);
+
+    static Recorder& s_instance;
+    std::ifstream m_input;
+    std::ofstream m_output;
+    GLFWkeyfun m_callbackKeyboard{ nullptr };
+    GLFWcursorposfun m_callbackCursor{ nullptr };
+    GLFWscrollfun m_callbackScroll{ nullptr };
+    Replay::Mode m_mode{ Replay::OFF };
+    GLuint m_frames{ 0 };
+    GLuint m_mouseButtons{ 0 };
+    GLuint m_seed;
+};
+
+#endif // !RECORDER_H
\ No newline at end of file
@@ -0,0 +1,84 @@
+#include "render_queue.h"
+
+// C++ standard library headers
+#include <algorithm>
+
+const std::vector<RenderQueue::DrawItem>& RenderQueue::getItems() const {
+    // return queued items
+    return m_items;
+}
+
+GLfloat RenderQueue::getDistance(const glm::vec3& eye,
+    const glm::vec3& boundsMin,
+    const glm::vec3& boundsMax) {
+    // distance from eye to the closest point of an axis-aligned box
+    return glm::length(glm::clamp(eye, boundsMin, boundsMax) - eye);
+}
+
+void RenderQueue::clear() {
+    // remove all items, keeping storage for the next pass
+    m_items.clear();
+}
+
+void RenderQueue::sort() {
+    // sort items by key, items with equal keys keep submission order
+    std::stable_sort(m_items.begin(),
+        m_items.end(),
+        isKeyLess);
+}
+
+void RenderQueue::submit(Rendering::Pass pass,
+    Rendering::Layer layer,
+    Rendering::Drawable drawable,
+    Shader* shader,
+    GLuint material,
+    GLuint VAO,
+    GLfloat depth) {
+    // quantize depth over the camera range
+    GLuint depthMax{ (1u << RENDER_QUEUE_BITS_DEPTH) - 1 };
+    GLuint depthKey{ static_cast<GLuint>(
+        glm::clamp(depth / CAMERA_PLANE_FAR, 0.0f, 1.0f) * depthMax) };
+
+    // items that set their own program sort first within their layer
+    GLuint program{ shader ? shader->getProgramID() : 0 };
+
+    // build key from most to least significant field
+    GLuint64 key{ static_cast<GLuint64>(pass) };
+    key = appendField(key, layer, RENDER_QUEUE_BITS_LAYER);
+    if (layer == Rendering::BLENDED) {
+        key = appendField(key, depthMax - depthKey, RENDER_QUEUE_BITS_DEPTH);
+        key = appendField(key, program, RENDER_QUEUE_BITS_PROGRAM);
+        key = appendField(key, material, RENDER_QUEUE_BITS_MATERIAL);
+        key = appendField(key, VAO, RENDER_QUEUE_BITS_VAO);
+    }
+    else {
+        key = appendField(key, program, RENDER_QUEUE_BITS_PROGRAM);
+        key = appendField(key, material, RENDER_QUEUE_BITS_MATERIAL);
+        key = appendField(key, VAO, RENDER_QUEUE_BITS_VAO);
+        key = appendField(key, depthKey, RENDER_QUEUE_BITS_DEPTH);
+    }
+
+    // align pass with the most significant bits
+    key <<= 64 - (RENDER_QUEUE_BITS_PASS
+        + RENDER_QUEUE_BITS_LAYER
+        + RENDER_QUEUE_BITS_PROGRAM
+        + RENDER_QUEUE_BITS_DEPTH
+        + RENDER_QUEUE_BITS_MATERIAL
+        + RENDER_QUEUE_BITS_VAO);
+
+    m_items.push_back({ key, pass, drawable, shader, material });
+}
+
+GLuint64 RenderQueue::appendField(GLuint64 key,
+    GLuint value,
+    GLuint bits) {
+    // shift key left and add value, truncated to given width
+    return (key << bits)
+        | (static_cast<GLuint64>(value) & ((1ull << bits) - 1));
+}
+
+bool RenderQueue::isKeyLess(const DrawItem& a,
+    const DrawItem& b) {
+    // compare items by key
+    return a.key < b.key;
+}
\ No newline at end of file
@@ -0,0 +1,61 @@
+#ifndef RENDER_QUEUE_H
+#define RENDER_QUEUE_H
+
+// project headers
+#include "constants.h"
+#include "enums.h"
+#include "shader.h"
+
+// GLEW
+#include <gl/glew.h>
+
+// GLM
+#include <glm/glm.hpp>
+
+// C++ standard library headers
+#include <vector>
+
+// draw items of a rendering pass, ordered by a 64-bit key built from the
+// pipeline state they need and their distance to the viewer: solid items
+// are grouped by program, material and vertex array object, and drawn front
+// to back within each group (early depth rejection), blended items are drawn
+// back to front
+class RenderQueue {
+public:
+    // queued draw, material is an index into the renderer's materials
+    struct DrawItem {
+        GLuint64 key;
+        Rendering::Pass pass;
+        Rendering::Drawable drawable;
+        Shader* shader;
+        GLuint material;
+    };
+
+    // getters
+    const std::vector<DrawItem>& getItems() const;
+    static GLfloat getDistance(const glm::vec3& eye,
+        const glm::vec3& boundsMin,
+        const glm::vec3& boundsMax);
+
+    // utilities
+    void clear();
+    void sort();
+    void submit(Rendering::Pass pass,
+        Rendering::Layer layer,
+        Rendering::Drawable drawable,
+        Shader* shader,
+        GLuint material,
+        GLuint VAO,
+        GLfloat depth);
+
+private:
+    static GLuint64 appendField(GLuint64 key,
+        GLuint value,
+        GLuint bits);
+    static bool isKeyLess(const DrawItem& a,
+        const DrawItem& b);
+
+    std::vector<DrawItem> m_items;
+};
+
+#endif // !RENDER_QUEUE_H
\ No newline at end of file
@@ -1,8 +1,15 @@
 #include "rendered_entity.h"
 
-// model VAO and VBO initialized to NULL
+// model VAOs and VBOs initialized to NULL
 GLuint RenderedEntity::s_modelVAO = NULL;
+GLuint RenderedEntity::s_modelDepthVAO = NULL;
 GLuint RenderedEntity::s_modelVBO = NULL;
+GLuint RenderedEntity::s_modelPositionVBO = NULL;
+GLuint RenderedEntity::s_modelEBO = NULL;
+
+// model mesh layout and index count, set with the model buffers
+MeshLayout RenderedEntity::s_modelLayout = {};
+GLuint RenderedEntity::s_modelIndexCount = 0;
 
 // smooth movement disabled by default
 bool RenderedEntity::s_smoothMovement = false;
@@ -44,10 +51,25 @@ const glm::vec3& RenderedEntity::getPosition() const {
     return m_position;
 }
 
+const glm::vec4& RenderedEntity::getColor() const {
+    // return current color
+    return m_color;
+}
+
 const glm::vec4& RenderedEntity::getColorOriginal() const {
     return m_colorOriginal;
 }
 
+GLuint RenderedEntity::getVAO() const {
+    // return vertex array object
+    return m_VAO;
+}
+
+GLuint RenderedEntity::getDepthVAO() const {
+    // return position-only vertex array object
+    return m_depthVAO;
+}
+
 void RenderedEntity::setSpeedCurrent(GLfloat value) {
     // set movement speed
     s_speedCurrent = value;
@@ -193,59 +215,71 @@ void RenderedEntity::toggleSmoothMovement() {
 }
 
 void RenderedEntity::render(Rendering::Primitive primitive) const {
-    // bind vertex array object
-    Shader::bindVAO(m_VAO);
-
-    // render
+    // render with the vertex array object bound when setting shader
+    // attributes (full or position-only)
     switch (primitive) {
     case Rendering::POINTS:
-        glPointSize(RENDERING_POINT_SIZE);
-        if (m_EBO != NULL)
-            glDrawElements(GL_POINTS,
-                m_vertexCount,
-                GL_UNSIGNED_INT,
-                0);
-        else
-            glDrawArrays(GL_POINTS,
-                0,
-                m_vertexCount);
-        glPointSize(1.0f);
+        // point size only affects point primitives, so it is left set
+        GLState::setPointSize(RENDERING_POINT_SIZE);
+        glDrawElements(GL_POINTS,
+            m_indexCount,
+            m_layout.m_indexType,
+            0);
         break;
     case Rendering::LINES:
-        if (m_EBO != NULL)
-            glDrawElements(GL_TRIANGLES,
-                m_vertexCount,
-                GL_UNSIGNED_INT,
-                0);
-        else
-            glDrawArrays(GL_TRIANGLES,
-                0,
-                m_vertexCount);
+    case Rendering::TRIANGLES:
+        glDrawElements(GL_TRIANGLES,
+            m_indexCount,
+            m_layout.m_indexType,
+            0);
+        break;
+    }
+}
+
+void RenderedEntity::renderInstanced(Rendering::Primitive primitive,
+    const std::vector<ModelInstance>& instances) const {
+    // only model entities have instance attributes
+    if (!m_modelEntity || instances.empty())
+        return;
+
+    // write instance data to this frame's stream buffer region, point
+    // instance attributes of the vertex array object bound when setting
+    // shader attributes at it
+    GLintptr offset{ StreamBuffer::write(&instances[0],
+        instances.size() * sizeof(ModelInstance)) };
+    setInstanceAttributes(offset);
+
+    // render all instances at once
+    GLsizei instanceCount{ static_cast<GLsizei>(instances.size()) };
+    switch (primitive) {
+    case Rendering::POINTS:
+        GLState::setPointSize(RENDERING_POINT_SIZE);
+        glDrawElementsInstanced(GL_POINTS,
+            m_indexCount,
+            m_layout.m_indexType,
+            0,
+            instanceCount);
         break;
+    case Rendering::LINES:
     case Rendering::TRIANGLES:
-        if (m_EBO != NULL)
-            glDrawElements(GL_TRIANGLES,
-                m_vertexCount,
-                GL_UNSIGNED_INT,
-                0);
-        else
-            glDrawArrays(GL_TRIANGLES,
-                0,
-                m_vertexCount);
+        glDrawElementsInstanced(GL_TRIANGLES,
+            m_indexCount,
+            m_layout.m_indexType,
+            0,
+            instanceCount);
         break;
     }
 }
 
-void RenderedEntity::setColorShaderAttributes(Shader* shader) const {
-    // set shader attributes and color uniforms
-    shader->setColorAttributes(m_VAO, m_VBO, m_EBO);
-    shader->setUniformVec4(UNIFORM_COLOR,
-        m_color);
+void RenderedEntity::bindDepthVertexArray() const {
+    // bind position-only vertex array object, for depth-only passes
+    GLState::bindVertexArray(m_depthVAO);
 }
 
-void RenderedEntity::setDepthShaderAttributes(Shader* shader) const {
-    // set shader attributes
-    shader->setDepthAttributes(m_VAO, m_VBO, m_EBO);
+void RenderedEntity::bindVertexArray() const {
+    // bind full vertex array object, the color comes from the draw data or
+    // the instance buffer
+    GLState::bindVertexArray(m_VAO);
 }
 
 void RenderedEntity::clampPosition() {
@@ -263,58 +297,161 @@ void RenderedEntity::clampPosition() {
 
 void RenderedEntity::initializeModelEntity(GLfloat vertices[],
     GLuint verticesSize) {
-    // generate and bind vertex array object
+    // generate vertex array objects, model matrix and color attributes
+    // advance once per instance (depth-only passes skip the color)
     if (!s_modelVAO) {
         glGenVertexArrays(1, &s_modelVAO);
-        Shader::bindVAO(s_modelVAO);
+        GLState::bindVertexArray(s_modelVAO);
+        enableInstanceAttributes(true);
+
+        glGenVertexArrays(1, &s_modelDepthVAO);
+        GLState::bindVertexArray(s_modelDepthVAO);
+        enableInstanceAttributes(false);
     }
     m_VAO = s_modelVAO;
+    m_depthVAO = s_modelDepthVAO;
 
-    // generate and bind vertex buffect object, buffer data
+    // build packed, indexed mesh, generate buffers and buffer data
     if (!s_modelVBO) {
-        glGenBuffers(1, &s_modelVBO);
-        Shader::bindVBO(s_modelVBO);
-        glBufferData(GL_ARRAY_BUFFER,
+        Mesh mesh{ MeshBuilder::build(vertices,
             verticesSize,
-            vertices,
-            GL_STATIC_DRAW);
+            VERTEX_COMPONENTS,
+            true) };
+        glGenBuffers(1, &s_modelPositionVBO);
+        glGenBuffers(1, &s_modelVBO);
+        glGenBuffers(1, &s_modelEBO);
+        MeshBuilder::upload(mesh,
+            s_modelPositionVBO,
+            s_modelVBO,
+            s_modelEBO);
+        s_modelLayout = mesh.m_layout;
+        s_modelIndexCount = mesh.m_indexCount;
+        initializeVertexArrays(s_modelVAO,
+            s_modelDepthVAO,
+            s_modelLayout,
+            s_modelPositionVBO,
+            s_modelVBO,
+            s_modelEBO);
     }
     m_VBO = s_modelVBO;
+    m_positionVBO = s_modelPositionVBO;
+    m_EBO = s_modelEBO;
+    m_layout = s_modelLayout;
+    m_indexCount = s_modelIndexCount;
+}
 
-    // set vertex count
-   m_vertexCount = verticesSize / (6 * sizeof(GLfloat));
+void RenderedEntity::enableInstanceAttributes(bool colored) {
+    // enable instance attributes of the bound vertex array object
+    for (GLuint i{ 0 }; i != 4; ++i) {
+        glEnableVertexAttribArray(ATTRIBUTE_LOCATION_INSTANCE_MODEL + i);
+        glVertexAttribDivisor(ATTRIBUTE_LOCATION_INSTANCE_MODEL + i, 1);
+    }
+    if (colored) {
+        glEnableVertexAttribArray(ATTRIBUTE_LOCATION_INSTANCE_COLOR);
+        glVertexAttribDivisor(ATTRIBUTE_LOCATION_INSTANCE_COLOR, 1);
+    }
+    setInstanceAttributes(0);
+}
+
+void RenderedEntity::setInstanceAttributes(GLintptr offset) {
+    // point instance attributes of the bound vertex array object at the
+    // instance data written to the stream buffer at the given offset
+    GLState::bindBuffer(GL_ARRAY_BUFFER, StreamBuffer::getBuffer());
+    for (GLuint i{ 0 }; i != 4; ++i)
+        glVertexAttribPointer(ATTRIBUTE_LOCATION_INSTANCE_MODEL + i,
+            4,
+            GL_FLOAT,
+            GL_FALSE,
+            sizeof(ModelInstance),
+            (void*)(offset + i * sizeof(glm::vec4)));
+    glVertexAttribPointer(ATTRIBUTE_LOCATION_INSTANCE_COLOR,
+        4,
+        GL_FLOAT,
+        GL_FALSE,
+        sizeof(ModelInstance),
+        (void*)(offset + 4 * sizeof(glm::vec4)));
 }
 
 void RenderedEntity::initializeRegularEntity(GLfloat vertices[],
     GLuint verticesSize,
     GLuint indices[],
     GLuint indicesSize) {
-    // generate and bind vertex array object
+    // generate full and position-only vertex array objects
+    glGenVertexArrays(1, &m_depthVAO);
     glGenVertexArrays(1, &m_VAO);
-    Shader::bindVAO(m_VAO);
+    GLState::bindVertexArray(m_VAO);
 
-    // generate and bind vertex buffect object, buffer data
-    glGenBuffers(1, &m_VBO);
-    Shader::bindVBO(m_VBO);
-    glBufferData(GL_ARRAY_BUFFER,
+    // build packed, indexed mesh, generate buffers and buffer data
+    Mesh mesh{ MeshBuilder::build(vertices,
         verticesSize,
-        vertices,
-        GL_STATIC_DRAW);
-
-    // generate and bind element array buffer, buffer data
-    if (indices) {
-        glGenBuffers(1, &m_EBO);
-        Shader::bindEBO(m_EBO);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER,
-            indicesSize,
-            indices,
-            GL_STATIC_DRAW);
-    }
+        VERTEX_COMPONENTS,
+        true,
+        indices,
+        indicesSize) };
+    glGenBuffers(1, &m_positionVBO);
+    glGenBuffers(1, &m_VBO);
+    glGenBuffers(1, &m_EBO);
+    MeshBuilder::upload(mesh,
+        m_positionVBO,
+        m_VBO,
+        m_EBO);
+    m_layout = mesh.m_layout;
+    m_indexCount = mesh.m_indexCount;
+    initializeVertexArrays(m_VAO,
+        m_depthVAO,
+        m_layout,
+        m_positionVBO,
+        m_VBO,
+        m_EBO);
+}
 
-    // set vertex count
-    if (m_EBO != NULL) {
-        m_vertexCount = indicesSize / sizeof(GLuint);
-    }
-    else
-        m_vertexCount = verticesSize / (6 * sizeof(GLfloat));
+void RenderedEntity::initializeVertexArrays(GLuint VAO,
+    GLuint depthVAO,
+    const MeshLayout& layout,
+    GLuint positionVBO,
+    GLuint attributeVBO,
+    GLuint EBO) {
+    // full vertex array object: positions in their own stream, as floats or
+    // half floats
+    GLState::bindVertexArray(VAO);
+    GLState::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+    GLState::bindBuffer(GL_ARRAY_BUFFER, positionVBO);
+    glVertexAttribPointer(ATTRIBUTE_LOCATION_POSITION,
+        layout.m_positionComponents,
+        layout.m_positionType,
+        GL_FALSE,
+        layout.m_positionStride,
+        (void*)0);
+    glEnableVertexAttribArray(ATTRIBUTE_LOCATION_POSITION);
+
+    // packed normals (signed normalized 10-10-10-2) and half float texture
+    // coordinates interleaved in the other
+    GLState::bindBuffer(GL_ARRAY_BUFFER, attributeVBO);
+    glVertexAttribPointer(ATTRIBUTE_LOCATION_NORMAL,
+        4,
+        GL_INT_2_10_10_10_REV,
+        GL_TRUE,
+        VERTEX_ATTRIBUTE_STRIDE,
+        (void*)0);
+    glEnableVertexAttribArray(ATTRIBUTE_LOCATION_NORMAL);
+    glVertexAttribPointer(ATTRIBUTE_LOCATION_TEXTURE,
+        2,
+        GL_HALF_FLOAT,
+        GL_FALSE,
+        VERTEX_ATTRIBUTE_STRIDE,
+        (void*)sizeof(GLuint));
+    glEnableVertexAttribArray(ATTRIBUTE_LOCATION_TEXTURE);
+
+    // position-only vertex array object: depth-only passes fetch positions
+    // alone
+    GLState::bindVertexArray(depthVAO);
+    GLState::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+    GLState::bindBuffer(GL_ARRAY_BUFFER, positionVBO);
+    glVertexAttribPointer(ATTRIBUTE_LOCATION_POSITION,
+        layout.m_positionComponents,
+        layout.m_positionType,
+        GL_FALSE,
+        layout.m_positionStride,
+        (void*)0);
+    glEnableVertexAttribArray(ATTRIBUTE_LOCATION_POSITION);
 }
\ No newline at end of file
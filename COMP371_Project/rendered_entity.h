@@ -5,6 +5,10 @@
 #include "constants.h"
 #include "enums.h"
 #include "material.h"
+#include "mesh.h"
+#include "mesh_builder.h"
+#include "model_instance.h"
+#include "stream_buffer.h"
 
 // GLEW
 #include <gl/glew.h>
@@ -56,9 +60,12 @@ public:
         m_color{ entity.m_color },
         m_colorOriginal{ entity.m_colorOriginal },
         m_VAO{ entity.m_VAO },
+        m_depthVAO{ entity.m_depthVAO },
         m_VBO{ entity.m_VBO },
+        m_positionVBO{ entity.m_positionVBO },
         m_EBO{ entity.m_EBO },
-        m_vertexCount{ entity.m_vertexCount },
+        m_layout{ entity.m_layout },
+        m_indexCount{ entity.m_indexCount },
         m_modelEntity{ entity.m_modelEntity },
         m_rotationSet{ entity.m_rotationSet },
         m_scaleSet{ entity.m_scaleSet },
@@ -80,9 +87,12 @@ public:
         m_colorOriginal{ std::move(entity.m_colorOriginal) },
         m_modelEntity{ std::move(entity.m_modelEntity) },
         m_VAO{ std::move(entity.m_VAO) },
+        m_depthVAO{ std::move(entity.m_depthVAO) },
         m_VBO{ std::move(entity.m_VBO) },
+        m_positionVBO{ std::move(entity.m_positionVBO) },
         m_EBO{ std::move(entity.m_EBO) },
-        m_vertexCount{ std::move(entity.m_vertexCount) },
+        m_layout{ std::move(entity.m_layout) },
+        m_indexCount{ std::move(entity.m_indexCount) },
         m_rotationSet{ std::move(entity.m_rotationSet) },
         m_scaleSet{ std::move(entity.m_scaleSet) },
         m_translationSet{ std::move(entity.m_translationSet) } {}
@@ -95,7 +105,10 @@ public:
     const glm::vec3& getScalingRelative() const;
     const glm::vec3& getPivot() const;
     const glm::vec3& getPosition() const;
+    const glm::vec4& getColor() const;
     const glm::vec4& getColorOriginal() const;
+    GLuint getVAO() const;
+    GLuint getDepthVAO() const;
 
     // setters
     static void setSpeedCurrent(GLfloat value);
@@ -119,8 +132,10 @@ public:
     // utilities
     static void toggleSmoothMovement();
     void render(Rendering::Primitive primitive) const;
-    void setColorShaderAttributes(Shader* shader) const;
-    void setDepthShaderAttributes(Shader* shader) const;
+    void renderInstanced(Rendering::Primitive primitive,
+        const std::vector<ModelInstance>& instances) const;
+    void bindDepthVertexArray() const;
+    void bindVertexArray() const;
 
 private:
     void clampPosition();
@@ -130,11 +145,24 @@ private:
         GLuint verticesSize,
         GLuint indices[] = nullptr,
         GLuint indicesSize = 0);
+    static void initializeVertexArrays(GLuint VAO,
+        GLuint depthVAO,
+        const MeshLayout& layout,
+        GLuint positionVBO,
+        GLuint attributeVBO,
+        GLuint EBO);
+    static void enableInstanceAttributes(bool colored);
+    static void setInstanceAttributes(GLintptr offset);
 
     static bool s_smoothMovement;
     static GLfloat s_speedCurrent;
     static GLuint s_modelVAO;
+    static GLuint s_modelDepthVAO;
     static GLuint s_modelVBO;
+    static GLuint s_modelPositionVBO;
+    static GLuint s_modelEBO;
+    static MeshLayout s_modelLayout;
+    static GLuint s_modelIndexCount;
     glm::mat4 m_rotationMatrix;
     glm::mat4 m_rotationMatrixOriginal;
     glm::mat4 m_scalingMatrix;
@@ -150,9 +178,12 @@ private:
     glm::vec4 m_color;
     glm::vec4 m_colorOriginal;
     GLuint m_VAO;
+    GLuint m_depthVAO;
     GLuint m_VBO;
-    GLuint m_EBO{ NULL };
-    GLuint m_vertexCount;
+    GLuint m_positionVBO;
+    GLuint m_EBO;
+    MeshLayout m_layout;
+    GLuint m_indexCount;
     bool m_modelEntity;
     bool m_rotationSet{ false };
     bool m_scaleSet{ false };
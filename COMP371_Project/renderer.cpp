@@ -6,7 +6,14 @@ Renderer::~Renderer() {
         it != m_materials.end();
         ++it)
         (*it)->free();
+    m_sceneUniforms->free();
+    m_drawData->free();
     m_shadowMap->free();
+    m_cascadedShadowMap->free();
+    m_overdrawMap->free();
+    m_hud->free();
+    GPUTimer::free();
+    StreamBuffer::free();
 
     glDeleteVertexArrays(1, &m_axesVAO);
     glDeleteBuffers(1, &m_axesVBO);
@@ -14,6 +21,7 @@ Renderer::~Renderer() {
     glDeleteBuffers(1, &m_gridVBO);
     glDeleteVertexArrays(1, &m_lightVAO);
     glDeleteBuffers(1, &m_lightVBO);
+    glDeleteBuffers(1, &m_lightEBO);
 }
 
 Renderer& Renderer::get() {
@@ -38,12 +46,17 @@ GLfloat Renderer::getAnimationSpeedCurrent() const {
     return m_animationSpeedCurrent;
 }
 
+bool Renderer::isShadowBudgetEnabled() const {
+    // return whether shadow quality follows the frame budget
+    return m_shadowBudget.isEnabled();
+}
+
 void Renderer::setPrimitive(Rendering::Primitive primitive) {
     // set primitive
     if (primitive == Rendering::LINES)
-        glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
+        GLState::setPolygonMode(GL_LINE);
     else
-        glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+        GLState::setPolygonMode(GL_FILL);
     m_primitive = primitive;
 }
 
@@ -170,12 +183,76 @@ void Renderer::scaleModel(GLuint model,
 }
 
 void Renderer::render(GLfloat deltaTime) {
+    PROFILE_ZONE("Renderer::render");
+
+    // adapt shadow quality to the cost of previous frames, then start
+    // frame timings
+    updateShadowBudget();
+    StageTimer::beginFrame();
+    GPUTimer::beginFrame();
+    GLCounters::beginFrame();
+
+    // reclaim the stream buffer region written STREAM_BUFFER_FRAMES ago
+    StreamBuffer::beginFrame();
+
+    // advance time of day, then gather the frame's per-draw data
+    updateDayNightCycle(deltaTime);
+    updateDrawData();
+
+    // upload shared shader state that changed since the last frame and
+    // the frame's per-draw data
+    m_sceneUniforms->upload();
+    m_drawData->upload();
+
+    // render depth texture, then scene
+    beginStage(Timing::FIRST_PASS);
     renderFirstPass(deltaTime);
+    endStage(Timing::FIRST_PASS);
+    beginStage(Timing::SECOND_PASS);
+    if (m_overdrawEnabled)
+        m_overdrawMap->begin(Camera::get().getViewportWidth(),
+            Camera::get().getViewportHeight());
     renderSecondPass(deltaTime);
+    if (m_overdrawEnabled)
+        m_overdrawMap->end();
+    endStage(Timing::SECOND_PASS);
+
+    // optionally show fragment counts instead of the scene
+    if (m_overdrawEnabled) {
+        beginStage(Timing::OVERDRAW);
+        m_overdrawMap->render();
+        endStage(Timing::OVERDRAW);
+    }
 
-    // optionally render shadow map debug quad
-    if (m_debuggingEnabled)
+    // optionally render shadow map debug quad (cubemap only)
+    if (m_debuggingEnabled && m_shadowMode == Shadows::POINT) {
+        beginStage(Timing::SHADOW_DEBUG);
         m_shadowMap->render(m_lights.at(0));
+        endStage(Timing::SHADOW_DEBUG);
+    }
+
+    // optionally render performance overlay, always filled (frame intervals
+    // are sampled while it is hidden too, so showing it adds no false hitch)
+    m_hud->updateFrameTimes();
+    if (m_hudEnabled) {
+        beginStage(Timing::HUD);
+        if (m_primitive == Rendering::LINES)
+            GLState::setPolygonMode(GL_FILL);
+        m_hud->render(Camera::get().getViewportWidth(),
+            Camera::get().getViewportHeight(),
+            m_rainEnabled ? m_liveParticles : 0);
+        if (m_primitive == Rendering::LINES)
+            GLState::setPolygonMode(GL_LINE);
+        endStage(Timing::HUD);
+    }
+
+    // fence this frame's stream buffer region
+    StreamBuffer::endFrame();
+
+    // end frame timings
+    StageTimer::endFrame();
+    GPUTimer::endFrame();
+    GLCounters::endFrame();
 }
 
 void Renderer::toggleAnimations() {
@@ -216,6 +293,13 @@ void Renderer::toggleFrame() {
         << (m_frameEnabled ? "ENABLED" : "DISABLED") << std::endl;
 }
 
+void Renderer::toggleHud() {
+    // set whether performance overlay should be rendered or not
+    m_hudEnabled = !m_hudEnabled;
+    std::cout << "Performance overlay: "
+        << (m_hudEnabled ? "ENABLED" : "DISABLED") << std::endl;
+}
+
 void Renderer::toggleLights() {
     // set whether lights should be enabled or not
     m_lightsEnabled = !m_lightsEnabled;
@@ -223,6 +307,22 @@ void Renderer::toggleLights() {
         << (m_lightsEnabled ? "ENABLED" : "DISABLED") << std::endl;
 }
 
+void Renderer::toggleOverdraw() {
+    // set whether fragment counts should be shown instead of the scene
+    m_overdrawEnabled = !m_overdrawEnabled;
+    std::cout << "Overdraw: "
+        << (m_overdrawEnabled ? "ENABLED" : "DISABLED") << std::endl;
+    if (m_overdrawEnabled)
+        std::cout << "Fragments per pixel: black 0, blue "
+            << OVERDRAW_COUNT_MAX / 4.0f << ", green "
+            << OVERDRAW_COUNT_MAX / 2.0f << ", yellow "
+            << OVERDRAW_COUNT_MAX * 3.0f / 4.0f << ", red "
+            << OVERDRAW_COUNT_MAX << ", white above" << std::endl;
+
+    // update overdraw properties
+    updateOverdrawProperties();
+}
+
 void Renderer::togglePathing() {
     // set whether pathing should be enabled or not
     m_pathingEnabled = !m_pathingEnabled;
@@ -235,12 +335,48 @@ void Renderer::togglePathing() {
         toggleAnimations();
 }
 
+void Renderer::toggleShadowBudget() {
+    // set whether shadow quality should follow the frame budget, levels
+    // follow machine load and are not recorded, so a replay keeps the
+    // configured quality even if the recording toggled the budget on
+    if (!m_shadowBudget.isEnabled() && Recorder::get().isReplaying()) {
+        std::cout << "Adaptive shadow quality: unavailable while replaying"
+            << std::endl;
+        return;
+    }
+
+    m_shadowBudget.toggle();
+    applyShadowQuality();
+}
+
+void Renderer::toggleShadowMode() {
+    // switch between cascades of a directional light and the cubemap of a
+    // point light
+    m_shadowMode = m_shadowMode == Shadows::DIRECTIONAL
+        ? Shadows::POINT
+        : Shadows::DIRECTIONAL;
+    std::cout << "Shadow mode: "
+        << (m_shadowMode == Shadows::DIRECTIONAL ? "DIRECTIONAL" : "POINT")
+        << std::endl;
+
+    // swap depth texture storage, the allocated one is rendered next frame
+    allocateShadowMaps();
+    m_shadowFrame = 0;
+
+    // update shader properties
+    updateShadowProperties();
+}
+
 void Renderer::toggleShadows() {
     // set whether shadows should be enabled or not
     m_shadowsEnabled = !m_shadowsEnabled;
     std::cout << "Shadows: "
         << (m_shadowsEnabled ? "ENABLED" : "DISABLED") << std::endl;
 
+    // frames rendered without shadows do not measure their cost
+    if (m_shadowsEnabled)
+        m_shadowBudget.reset();
+
     // update shader properties
     updateShadowProperties();
 }
@@ -264,46 +400,16 @@ void Renderer::toggleRain() {
 }
 
 void Renderer::updateFogProperties() const {
-    // update fog propeties
-    Shader::useProgram(m_shaderEntity->getProgramID());
-    m_shaderEntity->setUniformVec4(UNIFORM_FOG_COLOR,
-        m_fogColor);
-    m_shaderEntity->setUniformFloat(UNIFORM_FOG_DENSITY,
-        FOG_DENSITY);
-    m_shaderEntity->setUniformBool(UNIFORM_FOG_ENABLED,
-        m_fogEnabled);
-
-    // do so for the skybox as well
-    m_skybox->updateFogProperties(m_fogEnabled);
-
-    // and for the grass
-    Shader::useProgram(m_shaderGrass->getProgramID());
-    m_shaderGrass->setUniformVec4(UNIFORM_FOG_COLOR,
-        m_fogColor);
-    m_shaderGrass->setUniformFloat(UNIFORM_FOG_DENSITY,
-        FOG_DENSITY);
-    m_shaderGrass->setUniformBool(UNIFORM_FOG_ENABLED,
+    // update fog propeties, the skybox uses its own fog
+    m_sceneUniforms->setFog(m_fogColor,
+        FOG_DENSITY,
         m_fogEnabled);
 }
 
 void Renderer::updateLightPositionsAndColors() {
     // update light position and color in shaders
-    Shader::useProgram(m_shaderEntity->getProgramID());
-    m_shaderEntity->setUniformVec3(UNIFORM_LIGHT_POSITION,
-        m_lights.at(0)->getWorldPosition(
-            getWorldOrientation()));
-    m_shaderEntity->setUniformVec4(UNIFORM_LIGHT_COLOR,
-        m_lights.at(0)->getColor());
-
-    // do so for the skybox as well
-    m_skybox->updateLightColor(m_lights.at(0)->getColor());
-
-    // and for the grass
-    Shader::useProgram(m_shaderGrass->getProgramID());
-    m_shaderGrass->setUniformVec3(UNIFORM_LIGHT_POSITION,
-        m_lights.at(0)->getWorldPosition(
-            getWorldOrientation()));
-    m_shaderGrass->setUniformVec4(UNIFORM_LIGHT_COLOR,
+    m_sceneUniforms->setLightPositionAndColor(
+        m_lights.at(0)->getWorldPosition(getWorldOrientation()),
         m_lights.at(0)->getColor());
 
     // update sun and moon positions
@@ -326,159 +432,113 @@ void Renderer::updateLightPositionsAndColors() {
 
 void Renderer::updateLightProperties() const {
     // update shaders light properties
-    Shader::useProgram(m_shaderEntity->getProgramID());
-    if (m_lightsEnabled) {
-        m_shaderEntity->setUniformVec3(UNIFORM_LIGHT_AMBIENT,
-            m_lights.at(0)->getAmbient());
-        m_shaderEntity->setUniformVec3(UNIFORM_LIGHT_DIFFUSE,
-            m_lights.at(0)->getDiffuse());
-        m_shaderEntity->setUniformVec3(UNIFORM_LIGHT_SPECULAR,
-            m_lights.at(0)->getSpecular());
-        m_shaderEntity->setUniformFloat(UNIFORM_LIGHT_KC,
-            m_lights.at(0)->getKC());
-        m_shaderEntity->setUniformFloat(UNIFORM_LIGHT_KL,
-            m_lights.at(0)->getKL());
-        m_shaderEntity->setUniformFloat(UNIFORM_LIGHT_KQ,
-            m_lights.at(0)->getKQ());
-    }
-    else {
-        m_shaderEntity->setUniformVec3(UNIFORM_LIGHT_AMBIENT,
-            glm::vec3(1.0f, 1.0f, 1.0f));
-        m_shaderEntity->setUniformVec3(UNIFORM_LIGHT_DIFFUSE,
-            glm::vec3(0.0f, 0.0f, 0.0f));
-        m_shaderEntity->setUniformVec3(UNIFORM_LIGHT_SPECULAR,
-            glm::vec3(0.0f, 0.0f, 0.0f));
-        m_shaderEntity->setUniformFloat(UNIFORM_LIGHT_KC,
-            1.0f);
-        m_shaderEntity->setUniformFloat(UNIFORM_LIGHT_KL,
-            0.0f);
-        m_shaderEntity->setUniformFloat(UNIFORM_LIGHT_KQ,
-            0.0f);
-    }
-    m_shaderEntity->setUniformFloat(UNIFORM_RIM_LIGHT_MAX,
-        LIGHT_RIM_MAX);
-    m_shaderEntity->setUniformFloat(UNIFORM_RIM_LIGHT_MIN,
-        LIGHT_RIM_MIN);
-    m_shaderEntity->setUniformVec4(UNIFORM_RIM_LIGHT_COLOR,
-        m_rimLightColor);
-
-    // and for the grass
-    Shader::useProgram(m_shaderGrass->getProgramID());
-    if (m_lightsEnabled) {
-        m_shaderGrass->setUniformVec3(UNIFORM_LIGHT_AMBIENT,
-            m_lights.at(0)->getAmbient());
-        m_shaderGrass->setUniformVec3(UNIFORM_LIGHT_DIFFUSE,
-            m_lights.at(0)->getDiffuse());
-        m_shaderGrass->setUniformVec3(UNIFORM_LIGHT_SPECULAR,
-            m_lights.at(0)->getSpecular());
-        m_shaderGrass->setUniformFloat(UNIFORM_LIGHT_KC,
-            m_lights.at(0)->getKC());
-        m_shaderGrass->setUniformFloat(UNIFORM_LIGHT_KL,
-            m_lights.at(0)->getKL());
-        m_shaderGrass->setUniformFloat(UNIFORM_LIGHT_KQ,
+    if (m_lightsEnabled)
+        m_sceneUniforms->setLightProperties(m_lights.at(0)->getAmbient(),
+            m_lights.at(0)->getDiffuse(),
+            m_lights.at(0)->getSpecular(),
+            m_lights.at(0)->getKC(),
+            m_lights.at(0)->getKL(),
             m_lights.at(0)->getKQ());
-    }
-    else {
-        m_shaderGrass->setUniformVec3(UNIFORM_LIGHT_AMBIENT,
-            glm::vec3(1.0f, 1.0f, 1.0f));
-        m_shaderGrass->setUniformVec3(UNIFORM_LIGHT_DIFFUSE,
-            glm::vec3(0.0f, 0.0f, 0.0f));
-        m_shaderGrass->setUniformVec3(UNIFORM_LIGHT_SPECULAR,
-            glm::vec3(0.0f, 0.0f, 0.0f));
-        m_shaderGrass->setUniformFloat(UNIFORM_LIGHT_KC,
-            1.0f);
-        m_shaderGrass->setUniformFloat(UNIFORM_LIGHT_KL,
-            0.0f);
-        m_shaderGrass->setUniformFloat(UNIFORM_LIGHT_KQ,
+    else
+        m_sceneUniforms->setLightProperties(glm::vec3(1.0f, 1.0f, 1.0f),
+            glm::vec3(0.0f, 0.0f, 0.0f),
+            glm::vec3(0.0f, 0.0f, 0.0f),
+            1.0f,
+            0.0f,
             0.0f);
-    }
-    m_shaderGrass->setUniformFloat(UNIFORM_RIM_LIGHT_MAX,
+    m_sceneUniforms->setRimLight(m_rimLightColor,
+        LIGHT_RIM_MIN,
         LIGHT_RIM_MAX);
-    m_shaderGrass->setUniformFloat(UNIFORM_RIM_LIGHT_MIN,
-        LIGHT_RIM_MIN);
-    m_shaderGrass->setUniformVec4(UNIFORM_RIM_LIGHT_COLOR,
-        m_rimLightColor);
+}
+
+void Renderer::updateOverdrawProperties() const {
+    // set whether fragments should be counted instead of shaded
+    GLState::useProgram(m_shaderEntity->getProgramID());
+    m_shaderEntity->setUniform(UNIFORM_OVERDRAW_ENABLED,
+        m_overdrawEnabled);
 
-    // and for the particles
-    Shader::useProgram(m_shaderRain->getProgramID());
-    m_shaderRain->setUniformVec4(UNIFORM_RIM_LIGHT_COLOR,
-        m_rimLightColor);
+    // do so for the skybox as well
+    m_skybox->updateOverdraw(m_overdrawEnabled);
+
+    // and for the grass, rain, axes and grid
+    GLState::useProgram(m_shaderGrass->getProgramID());
+    m_shaderGrass->setUniform(UNIFORM_OVERDRAW_ENABLED,
+        m_overdrawEnabled);
+    GLState::useProgram(m_shaderRain->getProgramID());
+    m_shaderRain->setUniform(UNIFORM_OVERDRAW_ENABLED,
+        m_overdrawEnabled);
+    GLState::useProgram(m_shaderFrame->getProgramID());
+    m_shaderFrame->setUniform(UNIFORM_OVERDRAW_ENABLED,
+        m_overdrawEnabled);
 }
 
 void Renderer::updateProjectionMatrix() const {
     // update shaders projection matrix
-    Shader::useProgram(m_shaderEntity->getProgramID());
-    m_shaderEntity->setUniformMat4(UNIFORM_MATRIX_PROJECTION,
+    m_sceneUniforms->setProjectionMatrix(
         Camera::get().getProjectionMatrix());
-
-    Shader::useProgram(m_shaderFrame->getProgramID());
-    m_shaderFrame->setUniformMat4(UNIFORM_MATRIX_PROJECTION,
-        Camera::get().getProjectionMatrix());
-
-    // update skybox projection matrix
-    m_skybox->updateProjectionMatrix(Camera::get().getProjectionMatrix());
 }
 
 void Renderer::updateShadowProperties() const {
     // update shader properties
-    Shader::useProgram(m_shaderEntity->getProgramID());
-    m_shaderEntity->setUniformBool(UNIFORM_SHADOWS_ENABLED,
+    GLState::useProgram(m_shaderEntity->getProgramID());
+    m_shaderEntity->setUniform(UNIFORM_SHADOWS_ENABLED,
         m_shadowsEnabled);
-    m_shaderEntity->setUniformUInt(UNIFORM_SHADOW_GRID_SAMPLES,
-        ShadowMap::getGridSamples());
-    m_shaderEntity->setUniformFloat(UNIFORM_SHADOW_GRID_OFFSET,
+    m_shaderEntity->setUniform(UNIFORM_SHADOW_GRID_SAMPLES,
+        m_shadowBudget.getGridSamples(ShadowMap::getGridSamples()));
+    m_shaderEntity->setUniform(UNIFORM_SHADOW_GRID_OFFSET,
         ShadowMap::getGridOffset());
-    m_shaderEntity->setUniformFloat(UNIFORM_SHADOW_GRID_FACTOR,
+    m_shaderEntity->setUniform(UNIFORM_SHADOW_GRID_FACTOR,
         ShadowMap::getGridFactor());
-    m_shaderEntity->setUniformFloat(UNIFORM_SHADOW_BIAS_MIN,
+    m_shaderEntity->setUniform(UNIFORM_SHADOW_BIAS_MIN,
         ShadowMap::getBiasMin());
-    m_shaderEntity->setUniformFloat(UNIFORM_SHADOW_BIAS_MAX,
+    m_shaderEntity->setUniform(UNIFORM_SHADOW_BIAS_MAX,
         ShadowMap::getBiasMax());
-    m_shaderEntity->setUniformUInt(UNIFORM_SHADOW_DEPTH_TEXTURE,
+    m_shaderEntity->setUniform(UNIFORM_SHADOW_DEPTH_TEXTURE,
         TEXTURE_INDEX_DEPTH_MAP);
+    m_shaderEntity->setUniform(UNIFORM_SHADOW_DIRECTIONAL,
+        m_shadowMode == Shadows::DIRECTIONAL);
+    m_shaderEntity->setUniform(UNIFORM_SHADOW_CASCADE_COUNT,
+        m_cascadedShadowMap->getCascadeCount());
+    m_shaderEntity->setUniform(UNIFORM_SHADOW_CASCADE_TEXTURE,
+        TEXTURE_INDEX_CASCADE_MAP);
 }
 
 void Renderer::updateTextureProperties() const {
     // update shader properties
-    Shader::useProgram(m_shaderEntity->getProgramID());
-    m_shaderEntity->setUniformBool(UNIFORM_TEXTURES_ENABLED,
+    GLState::useProgram(m_shaderEntity->getProgramID());
+    m_shaderEntity->setUniform(UNIFORM_TEXTURES_ENABLED,
         m_texturesEnabled);
 }
 
 void Renderer::updateViewMatrix() const {
-    // update shaders view matrix and camera position
-    Shader::useProgram(m_shaderEntity->getProgramID());
-    m_shaderEntity->setUniformMat4(UNIFORM_MATRIX_VIEW,
-        Camera::get().getViewMatrix());
-    m_shaderEntity->setUniformVec3(UNIFORM_CAMERA_POSITION,
-        Camera::get().getPosition());
-
-    Shader::useProgram(m_shaderFrame->getProgramID());
-    m_shaderFrame->setUniformMat4(UNIFORM_MATRIX_VIEW,
-        Camera::get().getViewMatrix());
-
-    // update skybox view matrix
-    m_skybox->updateViewMatrix(Camera::get().getViewMatrix());
+    // update shaders view matrix, camera position and axes
+    m_sceneUniforms->setCamera(Camera::get().getViewMatrix(),
+        Camera::get().getPosition(),
+        Camera::get().getRightVector(),
+        Camera::get().getUpVector());
 }
 
 void Renderer::initialize() {
-    // initialize random seed
-    srand(static_cast<GLuint>(time(NULL)));
+    STARTUP_SCOPE("Renderer::initialize");
+
+    // initialize random seed (recorded or replayed along with input)
+    srand(Recorder::get().getSeed());
 
     // initialize model positions and scales
-    for (GLuint i{ 0 }; i != TROOP_COUNT; ++i) {
+    GLuint troopCount = Config::get().getTroopCount();
+    for (GLuint i{ 0 }; i != troopCount; ++i) {
         m_modelPositions.push_back(MODEL_POSITION_RELATIVE_TORSO);
         m_modelScales.push_back(glm::vec3(1.0f, 1.0f, 1.0f));
     }
 
     // reserve capacity for entities vector
-    m_entities.reserve(1 + TROOP_COUNT * 11);
+    m_entities.reserve(1 + troopCount * 11);
 
     // reserve capacity for joints vector
-    m_joints.reserve(TROOP_COUNT * 10);
+    m_joints.reserve(troopCount * 10);
 
     // reserve capacity for paths vector
-    m_paths.reserve(TROOP_COUNT);
+    m_paths.reserve(troopCount);
 
     // call separate initialization methods
     initializeFrame();
@@ -486,7 +546,7 @@ void Renderer::initialize() {
     initializeGrass();
     initializeParticles();
     initializeMaterial();
-    for (GLuint i{ 0 }; i != TROOP_COUNT; ++i) {
+    for (GLuint i{ 0 }; i != troopCount; ++i) {
         initializeAnimation();
         initializeModel();
     }
@@ -501,6 +561,9 @@ void Renderer::initialize() {
     updateLightPositionsAndColors();
     updateLightProperties();
 
+    // allocate the depth texture of the initial shadow mode
+    allocateShadowMaps();
+
     // set initial states for fog, shadows and textures
     updateFogProperties();
     updateShadowProperties();
@@ -508,135 +571,26 @@ void Renderer::initialize() {
 }
 
 void Renderer::initializeAnimation() {
-    // create animation
-    Animation* animation = new Animation();
-
-    // head keyframes
-    animation->addStep(new AnimationStep(JOINT_HEAD,
-        AXIS_Z, 0, 15.0f));
-    animation->addStep(new AnimationStep(JOINT_HEAD,
-        AXIS_Z, 1, -5.0f));
-    animation->addStep(new AnimationStep(JOINT_HEAD,
-        AXIS_Z, 2, 5.0f));
-    animation->addStep(new AnimationStep(JOINT_HEAD,
-        AXIS_Z, 3, -5.0f));
-
-    // neck keyframes
-    animation->addStep(new AnimationStep(JOINT_NECK,
-        AXIS_Z, 0, 10.0f));
-    animation->addStep(new AnimationStep(JOINT_NECK,
-        AXIS_Z, 1, 10.0f));
-    animation->addStep(new AnimationStep(JOINT_NECK,
-        AXIS_Z, 2, -5.0f));
-    animation->addStep(new AnimationStep(JOINT_NECK,
-        AXIS_Z, 3, -10.0f));
-
-    // leg upper front right keyframes
-    animation->addStep(new AnimationStep(JOINT_LEG_UPPER_FRONT_RIGHT,
-        AXIS_Z, 0, 35.0f));
-    animation->addStep(new AnimationStep(JOINT_LEG_UPPER_FRONT_RIGHT,
-        AXIS_Z, 1, -40.0f));
-    animation->addStep(new AnimationStep(JOINT_LEG_UPPER_FRONT_RIGHT,
-        AXIS_Z, 2, 80.0f));
-    animation->addStep(new AnimationStep(JOINT_LEG_UPPER_FRONT_RIGHT,
-        AXIS_Z, 3, -20.0f));
-
-    // leg lower front right keyframes
-    animation->addStep(new AnimationStep(JOINT_LEG_LOWER_FRONT_RIGHT,
-        AXIS_Z, 0, -20.0f));
-    animation->addStep(new AnimationStep(JOINT_LEG_LOWER_FRONT_RIGHT,
-        AXIS_Z, 1, -15.0f));
-    animation->addStep(new AnimationStep(JOINT_LEG_LOWER_FRONT_RIGHT,
-        AXIS_Z, 2, -70.0f));
-    animation->addStep(new AnimationStep(JOINT_LEG_LOWER_FRONT_RIGHT,
-        AXIS_Z, 3, 40.0f));
-
-    // leg upper back right keyframes
-    animation->addStep(new AnimationStep(JOINT_LEG_UPPER_BACK_RIGHT,
-        AXIS_Z, 0, -25.0f));
-    animation->addStep(new AnimationStep(JOINT_LEG_UPPER_BACK_RIGHT,
-        AXIS_Z, 1, -65.0f));
-    animation->addStep(new AnimationStep(JOINT_LEG_UPPER_BACK_RIGHT,
-        AXIS_Z, 2, 20.0f));
-    animation->addStep(new AnimationStep(JOINT_LEG_UPPER_BACK_RIGHT,
-        AXIS_Z, 3, -15.0f));
-
-    // leg lower back right keyframes
-    animation->addStep(new AnimationStep(JOINT_LEG_LOWER_BACK_RIGHT,
-        AXIS_Z, 0, 15.0f));
-    animation->addStep(new AnimationStep(JOINT_LEG_LOWER_BACK_RIGHT,
-        AXIS_Z, 1, 25.0f));
-    animation->addStep(new AnimationStep(JOINT_LEG_LOWER_BACK_RIGHT,
-        AXIS_Z, 2, 40.0f));
-    animation->addStep(new AnimationStep(JOINT_LEG_LOWER_BACK_RIGHT,
-        AXIS_Z, 3, -10.0f));
-
-    // leg upper front left keyframes
-    animation->addStep(new AnimationStep(JOINT_LEG_UPPER_FRONT_LEFT,
-        AXIS_Z, 0, 40.0f));
-    animation->addStep(new AnimationStep(JOINT_LEG_UPPER_FRONT_LEFT,
-        AXIS_Z, 1, -35.0f));
-    animation->addStep(new AnimationStep(JOINT_LEG_UPPER_FRONT_LEFT,
-        AXIS_Z, 2, 65.0f));
-    animation->addStep(new AnimationStep(JOINT_LEG_UPPER_FRONT_LEFT,
-        AXIS_Z, 3, -25.0f));
-
-    // leg lower front left keyframes
-    animation->addStep(new AnimationStep(JOINT_LEG_LOWER_FRONT_LEFT,
-        AXIS_Z, 0, -25.0f));
-    animation->addStep(new AnimationStep(JOINT_LEG_LOWER_FRONT_LEFT,
-        AXIS_Z, 1, -20.0f));
-    animation->addStep(new AnimationStep(JOINT_LEG_LOWER_FRONT_LEFT,
-        AXIS_Z, 2, -55.0f));
-    animation->addStep(new AnimationStep(JOINT_LEG_LOWER_FRONT_LEFT,
-        AXIS_Z, 3, 45.0f));
-
-    // leg upper back left keyframes
-    animation->addStep(new AnimationStep(JOINT_LEG_UPPER_BACK_LEFT,
-        AXIS_Z, 0, -30.0f));
-    animation->addStep(new AnimationStep(JOINT_LEG_UPPER_BACK_LEFT,
-        AXIS_Z, 1, -70.0f));
-    animation->addStep(new AnimationStep(JOINT_LEG_UPPER_BACK_LEFT,
-        AXIS_Z, 2, 65.0f));
-    animation->addStep(new AnimationStep(JOINT_LEG_UPPER_BACK_LEFT,
-        AXIS_Z, 3, -25.0f));
-
-    // leg lower back left keyframes
-    animation->addStep(new AnimationStep(JOINT_LEG_LOWER_BACK_LEFT,
-        AXIS_Z, 0, 20.0f));
-    animation->addStep(new AnimationStep(JOINT_LEG_LOWER_BACK_LEFT,
-        AXIS_Z, 1, 30.0f));
-    animation->addStep(new AnimationStep(JOINT_LEG_LOWER_BACK_LEFT,
-        AXIS_Z, 2, 35.0f));
-    animation->addStep(new AnimationStep(JOINT_LEG_LOWER_BACK_LEFT,
-        AXIS_Z, 3, -15.0f));
-
-    // torso keyframes
-    animation->addStep(new AnimationStep(JOINT_TORSO,
-        AXIS_Z, 0, -5.0f));
-    animation->addStep(new AnimationStep(JOINT_TORSO,
-        AXIS_Z, 1, 10.0f));
-    animation->addStep(new AnimationStep(JOINT_TORSO,
-        AXIS_Z, 2, -10.0f));
-    animation->addStep(new AnimationStep(JOINT_TORSO,
-        AXIS_Z, 3, 15.0f));
-
-    // add animation to animations vector
-    m_animations.push_back(animation);
+    STARTUP_SCOPE("Renderer::initializeAnimation");
+
+    // create animation and add it to animations vector
+    m_animations.push_back(HorseFactory::createAnimation());
 }
 
 void Renderer::initializeFrame() {
+    STARTUP_SCOPE("Renderer::initializeFrame");
+
     // axes vertex data
     GLuint verticesSize;
     GLfloat* verticesAxes = VertexLoader::loadAxesVertices(&verticesSize);
 
     // generate and bind vertex array object
     glGenVertexArrays(1, &m_axesVAO);
-    Shader::bindVAO(m_axesVAO);
+    GLState::bindVertexArray(m_axesVAO);
 
     // generate and bind vertex buffer object, buffer data
     glGenBuffers(1, &m_axesVBO);
-    Shader::bindVBO(m_axesVBO);
+    GLState::bindBuffer(GL_ARRAY_BUFFER, m_axesVBO);
     glBufferData(GL_ARRAY_BUFFER,
         verticesSize,
         verticesAxes,
@@ -659,11 +613,11 @@ void Renderer::initializeFrame() {
 
     // generate and bind vertex array object
     glGenVertexArrays(1, &m_gridVAO);
-    Shader::bindVAO(m_gridVAO);
+    GLState::bindVertexArray(m_gridVAO);
 
     // generate and bind vertex buffer object, buffer data
     glGenBuffers(1, &m_gridVBO);
-    Shader::bindVBO(m_gridVBO);
+    GLState::bindBuffer(GL_ARRAY_BUFFER, m_gridVBO);
     glBufferData(GL_ARRAY_BUFFER,
         verticesSize,
         verticesGrid,
@@ -683,8 +637,12 @@ void Renderer::initializeFrame() {
 }
 
 void Renderer::initializeGrass() {
-    glm::vec3 offset[GRASS_COUNT];
-    for (GLuint i{ 0 }; i != GRASS_COUNT; ++i) {
+    STARTUP_SCOPE("Renderer::initializeGrass");
+
+    // grass offsets, sized at startup
+    GLuint grassCount = Config::get().getGrassCount();
+    std::vector<glm::vec3> offset(grassCount);
+    for (GLuint i{ 0 }; i != grassCount; ++i) {
         offset[i].x = static_cast<GLfloat>(rand()
             % GRID_SIZE - POSITION_MAX);
         offset[i].y = 0.0f;
@@ -693,15 +651,14 @@ void Renderer::initializeGrass() {
     }
 
     glGenBuffers(1, &m_grassVBOPos);
-    glBindBuffer(GL_ARRAY_BUFFER, m_grassVBOPos);
+    GLState::bindBuffer(GL_ARRAY_BUFFER, m_grassVBOPos);
     glBufferData(GL_ARRAY_BUFFER,
-        sizeof(glm::vec3) * GRASS_COUNT,
-        &offset[0],
+        sizeof(glm::vec3) * grassCount,
+        offset.data(),
         GL_STATIC_DRAW);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    GLState::bindBuffer(GL_ARRAY_BUFFER, 0);
 
-    offset[GRASS_COUNT];
-    for (GLuint i{ 0 }; i != GRASS_COUNT; ++i) {
+    for (GLuint i{ 0 }; i != grassCount; ++i) {
         offset[i].x = static_cast<GLfloat>(rand()
             % GRID_SIZE - POSITION_MAX);
         offset[i].y = 0.0f;
@@ -710,23 +667,25 @@ void Renderer::initializeGrass() {
     }
 
     glGenBuffers(1, &m_grassVBOPos2);
-    glBindBuffer(GL_ARRAY_BUFFER, m_grassVBOPos2);
+    GLState::bindBuffer(GL_ARRAY_BUFFER, m_grassVBOPos2);
     glBufferData(GL_ARRAY_BUFFER,
-        sizeof(glm::vec3) * GRASS_COUNT,
-        &offset[0],
+        sizeof(glm::vec3) * grassCount,
+        offset.data(),
         GL_STATIC_DRAW);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    GLState::bindBuffer(GL_ARRAY_BUFFER, 0);
 
     // vertex data
     GLuint verticesSize;
     GLfloat* verticesGrass = VertexLoader::loadGrassVertices(&verticesSize);
 
-    // buffers
-    glGenVertexArrays(1, &m_grassVAO);
-    glBindVertexArray(m_grassVAO);
+    // buffers, one vertex array object per grass version sharing the blade
+    // vertices and differing in their instance offsets, so that vertex
+    // layouts are only specified here
+    glGenVertexArrays(2, m_grassVAOs);
+    GLState::bindVertexArray(m_grassVAOs[0]);
 
     glGenBuffers(1, &m_grassVBO);
-    glBindBuffer(GL_ARRAY_BUFFER, m_grassVBO);
+    GLState::bindBuffer(GL_ARRAY_BUFFER, m_grassVBO);
     glBufferData(GL_ARRAY_BUFFER,
         verticesSize,
         verticesGrass,
@@ -737,48 +696,55 @@ void Renderer::initializeGrass() {
     GLuint* indicesGrass = VertexLoader::loadGrassIndices(&indicesSize);
 
     glGenBuffers(1, &m_grassEBO);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_grassEBO);
+    GLState::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_grassEBO);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER,
         indicesSize,
         indicesGrass,
         GL_STATIC_DRAW);
     delete[] indicesGrass;
 
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0,
-        3,
-        GL_FLOAT,
-        GL_FALSE,
-        8 * sizeof(GLfloat),
-        (void*)0);
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(1,
-        3,
-        GL_FLOAT,
-        GL_FALSE,
-        8 * sizeof(GLfloat),
-        (void*)(3 * sizeof(GLfloat)));
-    glEnableVertexAttribArray(2);
-    glVertexAttribPointer(2,
-        2,
-        GL_FLOAT,
-        GL_FALSE,
-        8 * sizeof(GLfloat),
-        (void*)(6 * sizeof(GLfloat)));
-
-    glBindBuffer(GL_ARRAY_BUFFER, m_grassVBOPos);
-    glEnableVertexAttribArray(3);
-    glVertexAttribPointer(3,
-        3,
-        GL_FLOAT,
-        GL_FALSE,
-        3 * sizeof(GLfloat),
-        (void*)0);
-    glVertexAttribDivisor(3, 1);
+    for (GLuint grassVersion{ 0 }; grassVersion != 2; ++grassVersion) {
+        GLState::bindVertexArray(m_grassVAOs[grassVersion]);
+        GLState::bindBuffer(GL_ARRAY_BUFFER, m_grassVBO);
+        GLState::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_grassEBO);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0,
+            3,
+            GL_FLOAT,
+            GL_FALSE,
+            8 * sizeof(GLfloat),
+            (void*)0);
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(1,
+            3,
+            GL_FLOAT,
+            GL_FALSE,
+            8 * sizeof(GLfloat),
+            (void*)(3 * sizeof(GLfloat)));
+        glEnableVertexAttribArray(2);
+        glVertexAttribPointer(2,
+            2,
+            GL_FLOAT,
+            GL_FALSE,
+            8 * sizeof(GLfloat),
+            (void*)(6 * sizeof(GLfloat)));
+
+        GLState::bindBuffer(GL_ARRAY_BUFFER, grassVersion == 0
+            ? m_grassVBOPos
+            : m_grassVBOPos2);
+        glEnableVertexAttribArray(3);
+        glVertexAttribPointer(3,
+            3,
+            GL_FLOAT,
+            GL_FALSE,
+            3 * sizeof(GLfloat),
+            (void*)0);
+        glVertexAttribDivisor(3, 1);
+    }
 
     // initialize grass materials
-    Shader::useProgram(m_shaderGrass->getProgramID());
-    m_shaderGrass->setUniformVec4(UNIFORM_COLOR,
+    GLState::useProgram(m_shaderGrass->getProgramID());
+    m_shaderGrass->setUniform(UNIFORM_COLOR,
         COLOR_GRASS);
     m_materials.push_back(new Material(
         Texture(PATH_TEXTURE_GRASS_0,
@@ -794,19 +760,11 @@ void Renderer::initializeGrass() {
             GL_REPEAT,
             GL_LINEAR).getID(),
         MATERIAL_SHININESS_GRASS));
-
-    glBindBuffer(GL_ARRAY_BUFFER, m_grassVBOPos2);
-    glEnableVertexAttribArray(3);
-    glVertexAttribPointer(3,
-        3,
-        GL_FLOAT,
-        GL_FALSE,
-        3 * sizeof(GLfloat),
-        (void*)0);
-    glVertexAttribDivisor(3, 1);
 }
 
 void Renderer::initializeGround() {
+    STARTUP_SCOPE("Renderer::initializeGround");
+
     // vertex data
     GLuint verticesSize;
     GLfloat* verticesGround = VertexLoader::loadGroundVertices(&verticesSize);
@@ -840,56 +798,63 @@ void Renderer::initializeGround() {
 }
 
 void Renderer::initializeLights() {
+    STARTUP_SCOPE("Renderer::initializeLights");
+
     // vertex data
     GLuint verticesSize;
     GLfloat* vertices = VertexLoader::loadCubeVertices(&verticesSize);
 
+    // build indexed mesh with half positions
+    Mesh mesh{ MeshBuilder::build(vertices,
+        verticesSize,
+        VERTEX_POSITION_COMPONENTS,
+        true) };
+    delete[] vertices;
+    m_lightIndexType = mesh.m_layout.m_indexType;
+    m_lightIndexCount = mesh.m_indexCount;
+
     // generate and bind vertex array object
     glGenVertexArrays(1, &m_lightVAO);
-    Shader::bindVAO(m_lightVAO);
+    GLState::bindVertexArray(m_lightVAO);
 
-    // generate and bind vertex buffer object, buffer data
+    // generate buffers, buffer data
     glGenBuffers(1, &m_lightVBO);
-    Shader::bindVBO(m_lightVBO);
-    glBufferData(GL_ARRAY_BUFFER,
-        verticesSize,
-        vertices,
-        GL_STATIC_DRAW);
-    delete[] vertices;
+    glGenBuffers(1, &m_lightEBO);
+    MeshBuilder::upload(mesh,
+        m_lightVBO,
+        0,
+        m_lightEBO);
 
     // vertex attributes
+    GLState::bindBuffer(GL_ARRAY_BUFFER, m_lightVBO);
     GLuint positionLocation = glGetAttribLocation(m_shaderFrame->getProgramID(),
         ATTRIBUTE_POSITION.c_str());
     glVertexAttribPointer(positionLocation,
-        3,
-        GL_FLOAT,
+        mesh.m_layout.m_positionComponents,
+        mesh.m_layout.m_positionType,
         GL_FALSE,
-        3 * sizeof(GLfloat),
+        mesh.m_layout.m_positionStride,
         (void*)0);
     glEnableVertexAttribArray(positionLocation);
 
     // create light source and add it to lights vector
     m_lights.push_back(new LightSource(LIGHT_POSITION_NOON, COLOR_LIGHT_DAY));
 
-    // set shader uniforms
-    Shader::useProgram(m_shaderEntity->getProgramID());
-    m_shaderEntity->setUniformVec2(UNIFORM_LIGHT_PLANES,
+    // set shader uniforms, attenuation is set with the other light
+    // properties
+    m_sceneUniforms->setLightPlanes(
         glm::vec2(m_lights.at(0)->getPlaneNear(),
             m_lights.at(0)->getPlaneFar()));
-    m_shaderEntity->setUniformFloat(UNIFORM_LIGHT_KC,
-        m_lights.at(0)->getKC());
-    m_shaderEntity->setUniformFloat(UNIFORM_LIGHT_KL,
-        m_lights.at(0)->getKL());
-    m_shaderEntity->setUniformFloat(UNIFORM_LIGHT_KQ,
-        m_lights.at(0)->getKQ());
-
-    Shader::useProgram(m_shaderShadow->getProgramID());
-    m_shaderShadow->setUniformVec2(UNIFORM_LIGHT_PLANES,
+
+    GLState::useProgram(m_shaderShadow->getProgramID());
+    m_shaderShadow->setUniform(UNIFORM_LIGHT_PLANES,
         glm::vec2(m_lights.at(0)->getPlaneNear(),
             m_lights.at(0)->getPlaneFar()));
 }
 
 void Renderer::initializeMaterial() {
+    STARTUP_SCOPE("Renderer::initializeMaterial");
+
     // initialize model material
     m_materials.push_back(new Material(
         Texture(PATH_TEXTURE_HORSE,
@@ -901,223 +866,14 @@ void Renderer::initializeMaterial() {
 }
 
 void Renderer::initializeModel() {
-    // vertex data
-    GLuint verticesSize;
-    GLfloat* vertices = VertexLoader::loadCubeFullVertices(&verticesSize);
-
-    // create model entities
-    RenderedEntity* head = new RenderedEntity(m_shaderEntity,
-        POSITION_ORIGIN,
-        0.5f * MODEL_POSITION_RELATIVE_HEAD,
-        vertices,
-        verticesSize,
-        nullptr,
-        NULL,
-        true);
-    delete[] vertices;
-    RenderedEntity* legLowerFrontRight = new RenderedEntity(*head);
-    RenderedEntity* legLowerFrontLeft = new RenderedEntity(*head);
-    RenderedEntity* legLowerBackRight = new RenderedEntity(*head);
-    RenderedEntity* legLowerBackLeft = new RenderedEntity(*head);
-    RenderedEntity* legUpperFrontRight = new RenderedEntity(*head);
-    RenderedEntity* legUpperFrontLeft = new RenderedEntity(*head);
-    RenderedEntity* legUpperBackRight = new RenderedEntity(*head);
-    RenderedEntity* legUpperBackLeft = new RenderedEntity(*head);
-    RenderedEntity* neck = new RenderedEntity(*head);
-    RenderedEntity* torso = new RenderedEntity(*head);
-
-    // set body parts joint pivot points
-    head->setPivot(0.5f * MODEL_POSITION_RELATIVE_HEAD);
-    legLowerFrontRight->setPivot(0.5f * MODEL_POSITION_RELATIVE_LEG_LOWER_FR);
-    legLowerFrontLeft->setPivot(0.5f * MODEL_POSITION_RELATIVE_LEG_LOWER_FL);
-    legLowerBackRight->setPivot(0.5f * MODEL_POSITION_RELATIVE_LEG_LOWER_BR);
-    legLowerBackLeft->setPivot(0.5f * MODEL_POSITION_RELATIVE_LEG_LOWER_BL);
-    legUpperFrontRight->setPivot(0.5f * MODEL_POSITION_RELATIVE_LEG_UPPER_FR);
-    legUpperFrontLeft->setPivot(0.5f * MODEL_POSITION_RELATIVE_LEG_UPPER_FL);
-    legUpperBackRight->setPivot(0.5f * MODEL_POSITION_RELATIVE_LEG_UPPER_BR);
-    legUpperBackLeft->setPivot(0.5f * MODEL_POSITION_RELATIVE_LEG_UPPER_BL);
-    neck->setPivot(0.5f * MODEL_POSITION_RELATIVE_NECK);
-    torso->setPivot(0.5f * MODEL_POSITION_RELATIVE_TORSO);
-
-    // set body parts color
-    head->setColor(MODEL_COLOR_HEAD);
-    legLowerFrontRight->setColor(MODEL_COLOR_LEG_LOWER);
-    legLowerFrontLeft->setColor(MODEL_COLOR_LEG_LOWER);
-    legLowerBackRight->setColor(MODEL_COLOR_LEG_LOWER);
-    legLowerBackLeft->setColor(MODEL_COLOR_LEG_LOWER);
-    legUpperFrontRight->setColor(MODEL_COLOR_LEG_UPPER);
-    legUpperFrontLeft->setColor(MODEL_COLOR_LEG_UPPER);
-    legUpperBackRight->setColor(MODEL_COLOR_LEG_UPPER);
-    legUpperBackLeft->setColor(MODEL_COLOR_LEG_UPPER);
-    neck->setColor(MODEL_COLOR_NECK);
-    torso->setColor(MODEL_COLOR_TORSO);
-
-    // scale body parts
-    head->scale(MODEL_SCALE_HEAD);
-    legLowerFrontRight->scale(MODEL_SCALE_LEG_LOWER);
-    legLowerFrontLeft->scale(MODEL_SCALE_LEG_LOWER);
-    legLowerBackRight->scale(MODEL_SCALE_LEG_LOWER);
-    legLowerBackLeft->scale(MODEL_SCALE_LEG_LOWER);
-    legUpperFrontRight->scale(MODEL_SCALE_LEG_UPPER);
-    legUpperFrontLeft->scale(MODEL_SCALE_LEG_UPPER);
-    legUpperBackRight->scale(MODEL_SCALE_LEG_UPPER);
-    legUpperBackLeft->scale(MODEL_SCALE_LEG_UPPER);
-    neck->scale(MODEL_SCALE_NECK);
-    torso->scale(MODEL_SCALE_TORSO);
-
-    // translate body parts to their appropriate locations
-    head->translate(MODEL_POSITION_RELATIVE_HEAD);
-    legLowerFrontRight->translate(MODEL_POSITION_RELATIVE_LEG_LOWER_FR);
-    legLowerFrontLeft->translate(MODEL_POSITION_RELATIVE_LEG_LOWER_FL);
-    legLowerBackRight->translate(MODEL_POSITION_RELATIVE_LEG_LOWER_BR);
-    legLowerBackLeft->translate(MODEL_POSITION_RELATIVE_LEG_LOWER_BL);
-    legUpperFrontRight->translate(MODEL_POSITION_RELATIVE_LEG_UPPER_FR);
-    legUpperFrontLeft->translate(MODEL_POSITION_RELATIVE_LEG_UPPER_FL);
-    legUpperBackRight->translate(MODEL_POSITION_RELATIVE_LEG_UPPER_BR);
-    legUpperBackLeft->translate(MODEL_POSITION_RELATIVE_LEG_UPPER_BL);
-    neck->translate(MODEL_POSITION_RELATIVE_NECK);
-    torso->translate(MODEL_POSITION_RELATIVE_TORSO);
-
-    // rotate head and neck, set torso rotation
-    head->rotate(MODEL_ORIENTATION_RELATIVE_HEAD.first,
-        MODEL_ORIENTATION_RELATIVE_HEAD.second);
-    neck->rotate(MODEL_ORIENTATION_RELATIVE_NECK.first,
-        MODEL_ORIENTATION_RELATIVE_NECK.second);
-    torso->lockRotation(true);
-
-    // add body parts to entities vector
-    m_entities.push_back(head);
-    m_entities.push_back(legLowerFrontRight);
-    m_entities.push_back(legLowerFrontLeft);
-    m_entities.push_back(legLowerBackRight);
-    m_entities.push_back(legLowerBackLeft);
-    m_entities.push_back(legUpperFrontRight);
-    m_entities.push_back(legUpperFrontLeft);
-    m_entities.push_back(legUpperBackRight);
-    m_entities.push_back(legUpperBackLeft);
-    m_entities.push_back(neck);
-    m_entities.push_back(torso);
+    STARTUP_SCOPE("Renderer::initializeModel");
 
     // create model object
-    m_models.push_back(new Model());
+    m_models.push_back(HorseFactory::createModel(m_shaderEntity,
+        m_entities,
+        m_joints));
     GLuint modelIndex = m_models.size() - 1;
 
-    // get indices of above entities
-    GLuint entitiesHead = modelIndex * 11 + 1;
-    GLuint entitiesLegLowerFrontRight = entitiesHead + 1;
-    GLuint entitiesLegLowerFrontLeft = entitiesHead + 2;
-    GLuint entitiesLegLowerBackRight = entitiesHead + 3;
-    GLuint entitiesLegLowerBackLeft = entitiesHead + 4;
-    GLuint entitiesLegUpperFrontRight = entitiesHead + 5;
-    GLuint entitiesLegUpperFrontLeft = entitiesHead + 6;
-    GLuint entitiesLegUpperBackRight = entitiesHead + 7;
-    GLuint entitiesLegUpperBackLeft = entitiesHead + 8;
-    GLuint entitiesNeck = entitiesHead + 9;
-    GLuint entitiesTorso = entitiesHead + 10;
-
-    // set up model hierarchy
-    m_models.at(modelIndex)->add(m_entities.at(entitiesTorso));
-    m_models.at(modelIndex)->attach(m_entities.at(entitiesNeck),
-        m_entities.at(entitiesTorso));
-    m_models.at(modelIndex)->attach(m_entities.at(entitiesHead),
-        m_entities.at(entitiesNeck));
-    m_models.at(modelIndex)->attach(m_entities.at(entitiesLegUpperFrontRight),
-        m_entities.at(entitiesTorso));
-    m_models.at(modelIndex)->attach(m_entities.at(entitiesLegUpperFrontLeft),
-        m_entities.at(entitiesTorso));
-    m_models.at(modelIndex)->attach(m_entities.at(entitiesLegUpperBackRight),
-        m_entities.at(entitiesTorso));
-    m_models.at(modelIndex)->attach(m_entities.at(entitiesLegUpperBackLeft),
-        m_entities.at(entitiesTorso));
-    m_models.at(modelIndex)->attach(m_entities.at(entitiesLegLowerFrontRight),
-        m_entities.at(entitiesLegUpperFrontRight));
-    m_models.at(modelIndex)->attach(m_entities.at(entitiesLegLowerFrontLeft),
-        m_entities.at(entitiesLegUpperFrontLeft));
-    m_models.at(modelIndex)->attach(m_entities.at(entitiesLegLowerBackRight),
-        m_entities.at(entitiesLegUpperBackRight));
-    m_models.at(modelIndex)->attach(m_entities.at(entitiesLegLowerBackLeft),
-        m_entities.at(entitiesLegUpperBackLeft));
-
-    // create model joints
-    Joint* joint0 = new Joint(m_entities.at(entitiesNeck),
-        m_entities.at(entitiesHead),
-        m_entities.at(entitiesHead)->getPivot(),
-        MODEL_ROTATION_HEAD_MAX,
-        MODEL_ROTATION_HEAD_MIN);
-    Joint* joint1 = new Joint(m_entities.at(entitiesTorso),
-        m_entities.at(entitiesNeck),
-        m_entities.at(entitiesNeck)->getPivot(),
-        MODEL_ROTATION_NECK_MAX,
-        MODEL_ROTATION_NECK_MIN);
-    Joint* joint2 = new Joint(m_entities.at(entitiesTorso),
-        m_entities.at(entitiesLegUpperFrontRight),
-        MODEL_SCALE_LEG_UPPER
-        * m_entities.at(entitiesLegUpperFrontRight)->getPivot(),
-        MODEL_ROTATION_LEG_UPPER_MAX,
-        MODEL_ROTATION_LEG_UPPER_MIN);
-    Joint* joint3 = new Joint(m_entities.at(entitiesLegUpperFrontRight),
-        m_entities.at(entitiesLegLowerFrontRight),
-        m_entities.at(entitiesLegLowerFrontRight)->getPivot(),
-        MODEL_ROTATION_LEG_LOWER_MAX,
-        MODEL_ROTATION_LEG_LOWER_MIN);
-    Joint* joint4 = new Joint(m_entities.at(entitiesTorso),
-        m_entities.at(entitiesLegUpperBackRight),
-        MODEL_SCALE_LEG_UPPER
-        * m_entities.at(entitiesLegUpperBackRight)->getPivot(),
-        MODEL_ROTATION_LEG_UPPER_MAX,
-        MODEL_ROTATION_LEG_UPPER_MIN);
-    Joint* joint5 = new Joint(m_entities.at(entitiesLegUpperBackRight),
-        m_entities.at(entitiesLegLowerBackRight),
-        m_entities.at(entitiesLegLowerBackRight)->getPivot(),
-        MODEL_ROTATION_LEG_LOWER_MAX,
-        MODEL_ROTATION_LEG_LOWER_MIN);
-    Joint* joint6 = new Joint(m_entities.at(entitiesTorso),
-        m_entities.at(entitiesLegUpperFrontLeft),
-        MODEL_SCALE_LEG_UPPER
-        * m_entities.at(entitiesLegUpperFrontLeft)->getPivot(),
-        MODEL_ROTATION_LEG_UPPER_MAX,
-        MODEL_ROTATION_LEG_UPPER_MIN);
-    Joint* joint7 = new Joint(m_entities.at(entitiesLegUpperFrontLeft),
-        m_entities.at(entitiesLegLowerFrontLeft),
-        m_entities.at(entitiesLegLowerFrontLeft)->getPivot(),
-        MODEL_ROTATION_LEG_LOWER_MAX,
-        MODEL_ROTATION_LEG_LOWER_MIN);
-    Joint* joint8 = new Joint(m_entities.at(entitiesTorso),
-        m_entities.at(entitiesLegUpperBackLeft),
-        MODEL_SCALE_LEG_UPPER
-        * m_entities.at(entitiesLegUpperBackLeft)->getPivot(),
-        MODEL_ROTATION_LEG_UPPER_MAX,
-        MODEL_ROTATION_LEG_UPPER_MIN);
-    Joint* joint9 = new Joint(m_entities.at(entitiesLegUpperBackLeft),
-        m_entities.at(entitiesLegLowerBackLeft),
-        m_entities.at(entitiesLegLowerBackLeft)->getPivot(),
-        MODEL_ROTATION_LEG_LOWER_MAX,
-        MODEL_ROTATION_LEG_LOWER_MIN);
-    Joint* joint10 = new Joint(nullptr,
-        m_entities.at(entitiesTorso),
-        m_entities.at(entitiesTorso)->getPivot(),
-        MODEL_ROTATION_TORSO_MAX,
-        MODEL_ROTATION_TORSO_MIN);
-
-    // add model joints to joints vector
-    m_joints.push_back(joint0);
-    m_joints.push_back(joint1);
-    m_joints.push_back(joint2);
-    m_joints.push_back(joint3);
-    m_joints.push_back(joint4);
-    m_joints.push_back(joint5);
-    m_joints.push_back(joint6);
-    m_joints.push_back(joint7);
-    m_joints.push_back(joint8);
-    m_joints.push_back(joint9);
-    m_joints.push_back(joint10);
-
-    // add joints to model
-    GLuint jointStart = modelIndex * 11;
-    GLuint jointEnd = jointStart + 11;
-    for (GLuint j{ jointStart }; j != jointEnd; ++j)
-        m_models.at(modelIndex)->addJoint(m_joints.at(j));
-
     // scale model
     for (GLuint i{ 0 }; i != 10; ++i)
         scaleModel(modelIndex, Transform::INCREASE);
@@ -1130,23 +886,29 @@ void Renderer::initializeModel() {
 }
 
 void Renderer::initializeParticles() {
-    for (GLuint i{ 0 }; i != PARTICLE_COUNT; ++i) {
+    STARTUP_SCOPE("Renderer::initializeParticles");
+
+    GLuint particleCount = Config::get().getParticleCount();
+    for (GLuint i{ 0 }; i != particleCount; ++i) {
         m_particles.push_back(new Particle());
         m_particles.at(i)->m_life = -1.0f;
         m_particles.at(i)->m_position.y = -1000.0f;
         m_particles.at(i)->m_distanceToCamera = -1.0f;
     }
 
+    // particle positions uploaded every frame
+    m_particleData.resize(particleCount);
+
     // vertex data
     GLuint verticesSize;
     GLfloat* verticesParticle = VertexLoader::loadParticleVertices(&verticesSize);
 
     // buffers
     glGenVertexArrays(1, &m_particleVAO);
-    glBindVertexArray(m_particleVAO);
+    GLState::bindVertexArray(m_particleVAO);
 
     glGenBuffers(1, &m_particleVBO);
-    glBindBuffer(GL_ARRAY_BUFFER, m_particleVBO);
+    GLState::bindBuffer(GL_ARRAY_BUFFER, m_particleVBO);
     glBufferData(GL_ARRAY_BUFFER,
         verticesSize,
         verticesParticle,
@@ -1157,19 +919,31 @@ void Renderer::initializeParticles() {
     GLuint* indicesParticle = VertexLoader::loadParticleIndices(&indicesSize);
 
     glGenBuffers(1, &m_particleEBO);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_particleEBO);
+    GLState::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_particleEBO);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER,
         indicesSize,
         indicesParticle,
         GL_STREAM_DRAW);
     delete[] indicesParticle;
 
-    glGenBuffers(1, &m_particleVBOPos);
-    glBindBuffer(GL_ARRAY_BUFFER, m_particleVBOPos);
-    glBufferData(GL_ARRAY_BUFFER,
-        sizeof(glm::vec3) * PARTICLE_COUNT,
-        NULL,
-        GL_STREAM_DRAW);
+    // quad vertices, instance positions are pointed at the stream buffer
+    // region written each frame
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0,
+        3,
+        GL_FLOAT,
+        GL_FALSE,
+        5 * sizeof(GLfloat),
+        (void*)0);
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1,
+        2,
+        GL_FLOAT,
+        GL_FALSE,
+        5 * sizeof(GLfloat),
+        (void*)(3 * sizeof(GLfloat)));
+    glEnableVertexAttribArray(2);
+    glVertexAttribDivisor(2, 1);
 
     m_materials.push_back(new Material(
         Texture(PATH_TEXTURE_RAIN,
@@ -1181,362 +955,429 @@ void Renderer::initializeParticles() {
 }
 
 void Renderer::initializePaths() {
+    STARTUP_SCOPE("Renderer::initializePaths");
+
     // create a sequence of random paths for each horse to follow
-    for (GLuint i{ 0 }; i != TROOP_COUNT; ++i) {
-        m_paths.push_back(new Path());
-
-        for (GLuint j{ 0 }; j != PATH_COUNT; ++j) {
-            GLfloat orientation = ((rand() % 2 == 0) ? -1 : 1)
-                * (rand()
-                    % static_cast<GLuint>(
-                        (PATHING_DIRECTION_MAX - PATHING_DIRECTION_MIN + 1))
-                    + PATHING_DIRECTION_MIN);
-            //GLfloat orientation = 10.0f;
-            GLfloat travelTime = (rand()
-                % static_cast<GLuint>(
-                    (PATHING_DISTANCE_MAX - PATHING_DISTANCE_MIN + 1))
-                + PATHING_DISTANCE_MIN);
-
-            m_paths.at(i)->addStep(new PathStep(j,
-                orientation,
-                travelTime));
-        }
-    }
+    for (GLuint i{ 0 }; i != Config::get().getTroopCount(); ++i)
+        m_paths.push_back(HorseFactory::createPath());
 }
 
 void Renderer::renderFirstPass(GLfloat deltaTime) {
+    // advance models (as the second pass does) and sort them into static and
+    // dynamic shadow casters
+    updateModels(deltaTime);
+    updateShadowCasters();
+
+    // lower shadow quality levels keep the depth texture for a few frames
+    if (m_shadowFrame != 0) {
+        --m_shadowFrame;
+        return;
+    }
+    m_shadowFrame = m_shadowBudget.getUpdateInterval() - 1;
+
+    // render the depth texture of the current shadow mode
+    if (m_shadowMode == Shadows::DIRECTIONAL)
+        renderCascadedShadows(deltaTime);
+    else
+        renderPointShadows(deltaTime);
+
+    // unbind shadow map framebuffer
+    GLState::bindFramebuffer(NULL);
+}
+
+void Renderer::renderCascadedShadows(GLfloat deltaTime) {
+    // fit the cascades to the camera frustum, the light shines from its
+    // world position towards the scene origin
+    glm::vec3 lightDirection{ glm::normalize(
+        m_lights.at(0)->getWorldPosition(getWorldOrientation())) };
+    m_cascadedShadowMap->update(Camera::get().getViewMatrix(),
+        Camera::get().getFOV(),
+        Camera::get().getViewportAspectRatio(),
+        lightDirection);
+
+    // the entity shader selects and projects into the same cascades
+    GLState::useProgram(m_shaderEntity->getProgramID());
+    m_shaderEntity->setUniform(UNIFORM_SHADOW_LIGHT_DIRECTION,
+        lightDirection);
+    m_shaderEntity->setUniform(UNIFORM_SHADOW_CASCADE_SPLITS,
+        m_cascadedShadowMap->getSplits());
+    m_shaderEntity->setUniformArray(UNIFORM_SHADOW_CASCADE_TRANSFORMS,
+        m_cascadedShadowMap->getTransforms());
+
+    // nothing changed since the layers were last rendered, keep them
+    if (m_cascadedShadowMap->isValid() && !haveShadowCastersMoved())
+        return;
+
+    // set viewport to depth texture dimensions
+    GLState::setViewport(0,
+        0,
+        m_cascadedShadowMap->getSize(),
+        m_cascadedShadowMap->getSize());
+
+    // render the ground and all models to each cascade they project into
+    std::vector<GLuint> models{ m_staticModels };
+    models.insert(models.end(), m_dynamicModels.begin(), m_dynamicModels.end());
+    GLState::useProgram(m_shaderShadowCascade->getProgramID());
+    for (GLuint cascade{ 0 };
+        cascade != m_cascadedShadowMap->getCascadeCount();
+        ++cascade) {
+        const glm::mat4& transform{
+            m_cascadedShadowMap->getTransforms().at(cascade) };
+        GLState::bindFramebuffer(m_cascadedShadowMap->getFBOID(cascade));
+        glClear(GL_DEPTH_BUFFER_BIT);
+
+        cullShadowCasters(models,
+            transform,
+            m_shadowModelInstances);
+        renderShadowFace(m_shaderShadowCascade,
+            transform,
+            Collision::isSphereInFrustum(transform,
+                POSITION_ORIGIN,
+                glm::length(glm::vec2(POSITION_MAX))),
+            deltaTime);
+    }
+
+    m_cascadedShadowMap->validate();
+    recordShadowCasters();
+}
+
+void Renderer::renderPointShadows(GLfloat deltaTime) {
+    // the static layer holds for one light position and world orientation
+    glm::vec3 lightPosition{ m_lights.at(0)->getWorldPosition(
+        getWorldOrientation()) };
+    m_shadowMap->setStaticState(lightPosition, getWorldOrientation());
+
+    // nothing changed since the depth texture was last rendered, keep it
+    bool staticValid{ m_shadowMap->isStaticLayerValid() };
+    if (staticValid && !haveShadowCastersMoved())
+        return;
+
     // compute depth texture transformation matrices
     glm::mat4 shadowProjection = glm::perspective(
         glm::radians(SHADOW_PROJECTION_FOV),
-        SHADOW_ASPECT_RATIO,
+        1.0f,
         m_lights.at(0)->getPlaneNear(),
         m_lights.at(0)->getPlaneFar());
     std::vector<glm::mat4> shadowTransforms;
     shadowTransforms.push_back(shadowProjection
-        * glm::lookAt(m_lights.at(0)->getWorldPosition(
-                getWorldOrientation()),
-            m_lights.at(0)->getWorldPosition(
-                getWorldOrientation())
-            + glm::vec3(1.0f, 0.0f, 0.0f),
+        * glm::lookAt(lightPosition,
+            lightPosition + glm::vec3(1.0f, 0.0f, 0.0f),
             glm::vec3(0.0f, -1.0f, 0.0f)));
     shadowTransforms.push_back(shadowProjection
-        * glm::lookAt(m_lights.at(0)->getWorldPosition(
-                getWorldOrientation()),
-            m_lights.at(0)->getWorldPosition(
-                getWorldOrientation())
-            + glm::vec3(-1.0f, 0.0f, 0.0f),
+        * glm::lookAt(lightPosition,
+            lightPosition + glm::vec3(-1.0f, 0.0f, 0.0f),
             glm::vec3(0.0f, -1.0f, 0.0f)));
     shadowTransforms.push_back(shadowProjection
-        * glm::lookAt(m_lights.at(0)->getWorldPosition(
-                getWorldOrientation()),
-            m_lights.at(0)->getWorldPosition(
-                getWorldOrientation())
-            + glm::vec3(0.0f, 1.0f, 0.0f),
+        * glm::lookAt(lightPosition,
+            lightPosition + glm::vec3(0.0f, 1.0f, 0.0f),
             glm::vec3(0.0f, 0.0f, 1.0f)));
     shadowTransforms.push_back(shadowProjection
-        * glm::lookAt(m_lights.at(0)->getWorldPosition(
-                getWorldOrientation()),
-            m_lights.at(0)->getWorldPosition(
-                getWorldOrientation())
-            + glm::vec3(0.0f, -1.0f, 0.0f),
+        * glm::lookAt(lightPosition,
+            lightPosition + glm::vec3(0.0f, -1.0f, 0.0f),
             glm::vec3(0.0f, 0.0f, -1.0f)));
     shadowTransforms.push_back(shadowProjection
-        * glm::lookAt(m_lights.at(0)->getWorldPosition(
-                getWorldOrientation()),
-            m_lights.at(0)->getWorldPosition(
-                getWorldOrientation())
-            + glm::vec3(0.0f, 0.0f, 1.0f),
+        * glm::lookAt(lightPosition,
+            lightPosition + glm::vec3(0.0f, 0.0f, 1.0f),
             glm::vec3(0.0f, -1.0f, 0.0f)));
     shadowTransforms.push_back(shadowProjection
-        * glm::lookAt(m_lights.at(0)->getWorldPosition(
-                getWorldOrientation()),
-            m_lights.at(0)->getWorldPosition(
-                getWorldOrientation())
-            + glm::vec3(0.0f, 0.0f, -1.0f),
+        * glm::lookAt(lightPosition,
+            lightPosition + glm::vec3(0.0f, 0.0f, -1.0f),
             glm::vec3(0.0f, -1.0f, 0.0f)));
 
     // set viewport to depth texture dimensions
-    glViewport(0,
+    GLState::setViewport(0,
         0,
-        SHADOW_DEPTH_TEXTURE_WIDTH,
-        SHADOW_DEPTH_TEXTURE_HEIGHT);
-
-    // bind and clear shadow map framebuffer
-    glBindFramebuffer(GL_FRAMEBUFFER, m_shadowMap->getFBOID());
-    glClear(GL_DEPTH_BUFFER_BIT);
+        m_shadowMap->getSize(),
+        m_shadowMap->getSize());
 
     // set shadow map shader uniforms
-    Shader::useProgram(m_shaderShadow->getProgramID());
-    for (GLuint i{ 0 }; i != shadowTransforms.size(); ++i)
-        m_shaderShadow->setUniformMat4(UNIFORM_SHADOW_TRANSFORMS
-            + "[" + std::to_string(i) + "]",
-            shadowTransforms[i]);
-    m_shaderShadow->setUniformVec3(UNIFORM_LIGHT_POSITION,
-        m_lights.at(0)->getWorldPosition(
-            getWorldOrientation()));
+    GLState::useProgram(m_shaderShadow->getProgramID());
+    m_shaderShadow->setUniform(UNIFORM_LIGHT_POSITION,
+        lightPosition);
+
+    // render the ground and static models to each face of the static layer
+    // they project into, when it changed
+    if (!staticValid) {
+        for (GLuint face{ 0 }; face != 6; ++face) {
+            GLState::bindFramebuffer(m_shadowMap->getStaticFaceFBOID(face));
+            glClear(GL_DEPTH_BUFFER_BIT);
+
+            cullShadowCasters(m_staticModels,
+                shadowTransforms.at(face),
+                m_shadowModelInstances);
+            renderShadowFace(m_shaderShadow,
+                shadowTransforms.at(face),
+                Collision::isSphereInFrustum(shadowTransforms.at(face),
+                    POSITION_ORIGIN,
+                    glm::length(glm::vec2(POSITION_MAX))),
+                deltaTime);
+        }
 
-    // render ground to depth texture
-    renderGround(m_shaderShadow);
+        m_shadowMap->validateStaticLayer();
+    }
 
-    // render models to depth texture
-    renderModels(m_shaderShadow, deltaTime);
+    // start from a copy of the static layer, render dynamic models over it
+    // in the faces they project into
+    m_shadowMap->copyStaticLayer();
+    for (GLuint face{ 0 }; face != 6; ++face) {
+        cullShadowCasters(m_dynamicModels,
+            shadowTransforms.at(face),
+            m_shadowModelInstances);
+        if (m_shadowModelInstances.empty())
+            continue;
+
+        GLState::bindFramebuffer(m_shadowMap->getFaceFBOID(face));
+        renderShadowFace(m_shaderShadow,
+            shadowTransforms.at(face),
+            false,
+            deltaTime);
+    }
 
-    // unbind shadow map framebuffer
-    glBindFramebuffer(GL_FRAMEBUFFER, NULL);
+    recordShadowCasters();
 }
 
 void Renderer::renderSecondPass(GLfloat deltaTime) {
     // set viewport back to window dimensions
-    glViewport(0,
+    GLState::setViewport(0,
         0,
         Camera::get().getViewportWidth(),
         Camera::get().getViewportHeight());
 
-    // clear buffer
-    glClearColor(COLOR_CLEAR.r, COLOR_CLEAR.g, COLOR_CLEAR.b, COLOR_CLEAR.a);
+    // clear buffer (fragment counts start at zero)
+    if (m_overdrawEnabled)
+        GLState::setClearColor(glm::vec4(0.0f));
+    else
+        GLState::setClearColor(COLOR_CLEAR);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-    // render skybox
+    // shadow depth textures sampled by the entity shader
+    GLState::activateTextureUnit(TEXTURE_UNIT_DEPTH_MAP);
+    GLState::bindTexture(GL_TEXTURE_CUBE_MAP, m_shadowMap->getDepthTextureID());
+    GLState::activateTextureUnit(TEXTURE_UNIT_CASCADE_MAP);
+    GLState::bindTexture(GL_TEXTURE_2D_ARRAY,
+        m_cascadedShadowMap->getDepthTextureID());
+
+    // queue scene elements, distances are measured in scene space (before
+    // world orientation) from the camera
+    glm::vec3 eye{ glm::inverse(getWorldOrientation())
+        * glm::vec4(Camera::get().getPosition(), 1.0f) };
+    m_renderQueue.clear();
     if (m_texturesEnabled)
-    m_skybox->render(Camera::get().getWorldOrientation(),
-        Camera::get().getPosition());
-
-    // shader uniforms: lighting
-    Shader::useProgram(m_shaderEntity->getProgramID());
+        m_renderQueue.submit(Rendering::SECOND,
+            Rendering::BACKGROUND,
+            Rendering::SKYBOX,
+            nullptr,
+            MATERIAL_INDEX_NONE,
+            NULL,
+            0.0f);
+    m_renderQueue.submit(Rendering::SECOND,
+        Rendering::SOLID,
+        Rendering::GROUND,
+        m_shaderEntity,
+        MATERIAL_INDEX_GROUND,
+        m_entities.at(0)->getVAO(),
+        getDrawableDistance(Rendering::GROUND, eye));
+    if (!m_models.empty())
+        m_renderQueue.submit(Rendering::SECOND,
+            Rendering::SOLID,
+            Rendering::MODELS,
+            m_shaderEntity,
+            MATERIAL_INDEX_HORSE,
+            m_models.front()->getHierarchy()->begin()->first->getVAO(),
+            getDrawableDistance(Rendering::MODELS, eye));
+    m_renderQueue.submit(Rendering::SECOND,
+        Rendering::SOLID,
+        Rendering::LIGHTS,
+        m_shaderFrame,
+        MATERIAL_INDEX_NONE,
+        m_lightVAO,
+        getDrawableDistance(Rendering::LIGHTS, eye));
+    if (m_frameEnabled)
+        m_renderQueue.submit(Rendering::SECOND,
+            Rendering::SOLID,
+            Rendering::FRAME,
+            m_shaderFrame,
+            MATERIAL_INDEX_NONE,
+            m_gridVAO,
+            getDrawableDistance(Rendering::FRAME, eye));
+    m_renderQueue.submit(Rendering::SECOND,
+        Rendering::BLENDED,
+        Rendering::GRASS_0,
+        m_shaderGrass,
+        MATERIAL_INDEX_GRASS_0,
+        m_grassVAOs[0],
+        getDrawableDistance(Rendering::GRASS_0, eye));
+    m_renderQueue.submit(Rendering::SECOND,
+        Rendering::BLENDED,
+        Rendering::GRASS_1,
+        m_shaderGrass,
+        MATERIAL_INDEX_GRASS_1,
+        m_grassVAOs[1],
+        getDrawableDistance(Rendering::GRASS_1, eye));
+    if (m_rainEnabled)
+        m_renderQueue.submit(Rendering::SECOND,
+            Rendering::BLENDED,
+            Rendering::PARTICLES,
+            m_shaderRain,
+            MATERIAL_INDEX_RAIN,
+            m_particleVAO,
+            getDrawableDistance(Rendering::PARTICLES, eye));
+
+    // render queued elements
+    m_renderQueue.sort();
+    renderQueuedItems(deltaTime);
+}
 
-    // render ground
-    m_materials.at(0)->use(m_shaderEntity);
-    Shader::activateTextureUnit(TEXTURE_UNIT_DEPTH_MAP);
-    Shader::bindCubemapTexture(m_shadowMap->getDepthTextureID());
-    renderGround(m_shaderEntity);
+void Renderer::renderQueuedItems(GLfloat deltaTime) {
+    // render items in key order, switching program and material only when
+    // they change (materials set uniforms, so a new program needs them again)
+    GLuint program{ NULL };
+    GLuint material{ MATERIAL_INDEX_NONE };
+    const std::vector<RenderQueue::DrawItem>& items = m_renderQueue.getItems();
+    for (std::vector<RenderQueue::DrawItem>::const_iterator it{ items.begin() };
+        it != items.end();
+        ++it) {
+        if (it->shader && it->shader->getProgramID() != program) {
+            program = it->shader->getProgramID();
+            material = MATERIAL_INDEX_NONE;
+            GLState::useProgram(program);
+        }
 
-    // render models
-    m_materials.at(4)->use(m_shaderEntity);
-    renderModels(m_shaderEntity, deltaTime);
+        // the rain shader has no material uniforms and only samples textures
+        if (it->material != MATERIAL_INDEX_NONE
+            && it->material != material) {
+            material = it->material;
+            if (it->shader == m_shaderRain)
+                m_materials.at(material)->bind();
+            else
+                m_materials.at(material)->use(it->shader);
+        }
 
-    // render light
-    renderLights(deltaTime);
+        renderItem(*it, deltaTime);
+    }
+}
 
-    // render axes and grid
-    if (m_frameEnabled)
+void Renderer::renderItem(const RenderQueue::DrawItem& item,
+    GLfloat deltaTime) {
+    // time scene elements individually, the first pass is timed as a whole
+    bool timed{ item.pass == Rendering::SECOND };
+    if (timed)
+        beginStage(getStage(item.drawable));
+
+    switch (item.drawable) {
+    case Rendering::SKYBOX:
+        m_skybox->render(Camera::get().getWorldOrientation(),
+            Camera::get().getPosition());
+        break;
+    case Rendering::GROUND:
+        renderGround(item.shader);
+        break;
+    case Rendering::MODELS:
+        // the first pass draws the casters of the shadow layer being
+        // rendered, models were already updated for it
+        if (item.pass == Rendering::FIRST)
+            renderModels(item.shader, m_shadowModelInstances);
+        else {
+            updateModels(deltaTime);
+            renderModels(item.shader, m_modelInstances);
+        }
+        break;
+    case Rendering::LIGHTS:
+        renderLights();
+        break;
+    case Rendering::FRAME:
         renderFrame();
-
-    // render grass
-    m_materials.at(1)->use(m_shaderGrass);
-    renderGrass(deltaTime, 0);
-    m_materials.at(2)->use(m_shaderGrass);
-    renderGrass(deltaTime, 1);
-
-    // render particles
-    if (m_rainEnabled) {
-        m_materials.at(3)->use(m_shaderRain);
+        break;
+    case Rendering::GRASS_0:
+        renderGrass(0);
+        break;
+    case Rendering::GRASS_1:
+        renderGrass(1);
+        break;
+    case Rendering::PARTICLES:
         renderParticles(deltaTime, POSITION_ORIGIN);
+        break;
     }
+
+    if (timed)
+        endStage(getStage(item.drawable));
 }
 
 void Renderer::renderFrame() {
     // set line width
-    glLineWidth(RENDERING_LINE_WIDTH);
+    GLState::setLineWidth(RENDERING_LINE_WIDTH);
 
-    // set shader uniforms
-    Shader::useProgram(m_shaderFrame->getProgramID());
-    Shader::bindVAO(m_axesVAO);
+    // render axes
+    GLState::useProgram(m_shaderFrame->getProgramID());
+    GLState::bindVertexArray(m_axesVAO);
     for (GLuint i{ 0 }; i != 3; ++i) {
-        // set model matrix and color
-        glm::mat4 modelMatrix;
-        modelMatrix *= getWorldOrientation()
-            * glm::rotate(modelMatrix,
-                glm::radians(ROTATION_AXES[i].first),
-                ROTATION_AXES[i].second);
-        m_shaderFrame->setUniformMat4(UNIFORM_MATRIX_MODEL,
-            modelMatrix);
-        m_shaderFrame->setUniformVec4(UNIFORM_COLOR,
-            COLOR_AXES[i]);
-
-        // render axes
+        m_shaderFrame->setUniform(UNIFORM_DRAW_INDEX,
+            Rendering::DRAW_AXIS_X + i);
         glDrawArrays(GL_LINES, 0, 2);
     }
 
-    // set model uniforms
-    glm::mat4 modelMatrix = getWorldOrientation();
-    m_shaderFrame->setUniformMat4(UNIFORM_MATRIX_MODEL,
-        modelMatrix);
-    m_shaderFrame->setUniformVec4(UNIFORM_COLOR,
-        COLOR_GRID);
-
     // render grid
-    Shader::bindVAO(m_gridVAO);
-    modelMatrix = getWorldOrientation();
-    m_shaderFrame->setUniformMat4(UNIFORM_MATRIX_MODEL,
-        modelMatrix);
+    GLState::bindVertexArray(m_gridVAO);
+    m_shaderFrame->setUniform(UNIFORM_DRAW_INDEX, Rendering::DRAW_GRID);
     glDrawArrays(GL_LINES, 0, 404);
 
     // revert line width to normal
-    glLineWidth(1.0f);
+    GLState::setLineWidth(1.0f);
 }
 
-void Renderer::renderGrass(GLfloat deltaTime,
-    GLuint grassVersion) {
-    Shader::useProgram(m_shaderGrass->getProgramID());
-    m_shaderGrass->setUniformMat4(UNIFORM_MATRIX_MODEL,
+void Renderer::renderGrass(GLuint grassVersion) {
+    GLState::useProgram(m_shaderGrass->getProgramID());
+    m_shaderGrass->setUniform(UNIFORM_MATRIX_MODEL,
         getWorldOrientation());
-    m_shaderGrass->setUniformMat4(UNIFORM_MATRIX_VIEW,
-        Camera::get().getViewMatrix());
-    m_shaderGrass->setUniformMat4(UNIFORM_MATRIX_PROJECTION,
-        Camera::get().getProjectionMatrix());
-    m_shaderGrass->setUniformFloat(UNIFORM_WIND_TIME,
+    m_shaderGrass->setUniform(UNIFORM_WIND_TIME,
         m_currentTime);
-    m_shaderGrass->setUniformFloat(UNIFORM_WIND_STRENGTH,
+    m_shaderGrass->setUniform(UNIFORM_WIND_STRENGTH,
         WIND_STRENGTH * sin(m_currentTime));
-    m_shaderGrass->setUniformVec3(UNIFORM_WIND_DIRECTION,
+    m_shaderGrass->setUniform(UNIFORM_WIND_DIRECTION,
         glm::normalize(
             glm::vec3(sin(m_currentTime), 0.0f, cos(m_currentTime))));
 
-    glBindVertexArray(m_grassVAO);
-    glBindBuffer(GL_ARRAY_BUFFER, m_grassVBO);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_grassEBO);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0,
-        3,
-        GL_FLOAT,
-        GL_FALSE,
-        8 * sizeof(GLfloat),
-        (void*)0);
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(1,
-        3,
-        GL_FLOAT,
-        GL_FALSE,
-        8 * sizeof(GLfloat),
-        (void*)(3 * sizeof(GLfloat)));
-    glEnableVertexAttribArray(2);
-    glVertexAttribPointer(2,
-        2,
-        GL_FLOAT,
-        GL_FALSE,
-        8 * sizeof(GLfloat),
-        (void*)(6 * sizeof(GLfloat)));
-
-    glBindBuffer(GL_ARRAY_BUFFER, grassVersion == 0
-        ? m_grassVBOPos
-        : m_grassVBOPos2);
-    glEnableVertexAttribArray(3);
-    glVertexAttribPointer(3,
-        3,
-        GL_FLOAT,
-        GL_FALSE,
-        3 * sizeof(GLfloat),
-        (void*)0);
-    glVertexAttribDivisor(0, 0);
-    glVertexAttribDivisor(1, 0);
-    glVertexAttribDivisor(2, 0);
-    glVertexAttribDivisor(3, 1);
-
+    GLState::bindVertexArray(m_grassVAOs[grassVersion]);
     glDrawArraysInstanced(GL_TRIANGLE_STRIP,
         0,
         12,
-        GRASS_COUNT);
+        Config::get().getGrassCount());
 }
 
 void Renderer::renderGround(Shader* shader) {
-    // set shader attributes
-    if (shader == m_shaderShadow)
-        m_entities.at(0)->setDepthShaderAttributes(shader);
+    // bind the vertex array object matching the shader's inputs
+    if (shader == m_shaderShadow || shader == m_shaderShadowCascade)
+        m_entities.at(0)->bindDepthVertexArray();
     else if (shader == m_shaderEntity)
-        m_entities.at(0)->setColorShaderAttributes(shader);
+        m_entities.at(0)->bindVertexArray();
 
-    // pass model matrix to shader and render
-    glm::mat4 modelMatrix = m_entities.at(0)->getModelMatrix(
-        getWorldOrientation());
-    shader->setUniformMat4(UNIFORM_MATRIX_MODEL, modelMatrix);
+    // point shader at the ground's draw data and render
+    shader->setUniform(UNIFORM_DRAW_INDEX, Rendering::DRAW_GROUND);
     m_entities.at(0)->render(m_primitive);
 }
 
-void Renderer::renderLights(GLfloat deltaTime) {
-    // handle day-night cycle
-    if (m_dayNightCycleEnabled) {
-        // increment time of day
-        m_currentTime += LIGHT_SPEED * deltaTime;
-
-        // update light position
-        glm::vec3 currentPosition = m_lights.at(0)->getPosition();
-        GLfloat nightTime = isNight() ? -1.0f : 1.0f;
-        GLfloat y = LIGHT_POSITION_NOON.y * sin(nightTime * m_currentTime);
-        GLfloat z = LIGHT_POSITION_NOON.y * nightTime * cos(m_currentTime);
-        glm::vec3 newPosition{ currentPosition.x, y, z };
-        m_lights.at(0)->setPosition(newPosition);
-        
-        // update light color
-        glm::vec4 currentColor = m_lights.at(0)->getColor();
-        glm::vec4 targetColor;
-
-        // night time
-        if (isNight())
-            targetColor = COLOR_LIGHT_NIGHT;
-
-        // day time
-        else if (isDay())
-            targetColor = COLOR_LIGHT_DAY;
-
-        // dawn or dusk time
-        else
-            targetColor = COLOR_LIGHT_TRANSITION;
-
-        // lerp color and assign to light and rim lighting
-        glm::vec4 newColor{ lerpColor(currentColor, targetColor, 0.1f) };
-        m_lights.at(0)->setColor(newColor);
-        m_rimLightColor = newColor;
-
-		// lerp between fog color and rim lighting color
-		m_fogColor = lerpColor(m_fogColor, m_rimLightColor, 0.6f);
-
-        // update shader properties
-        updateLightPositionsAndColors();
-
-        // reset timer after a full cycle
-        if (m_currentTime >= 2.0 * glm::pi<GLfloat>())
-            m_currentTime = 0.0f;
-    }
-
-    // set shader uniforms for sun
-    Shader::useProgram(m_shaderFrame->getProgramID());
-    glm::mat4 modelMatrix = getWorldOrientation()
-        * glm::translate(glm::mat4(), m_sunPosition)
-        * glm::scale(glm::mat4(), LIGHT_SCALE);
-    m_shaderFrame->setUniformMat4(UNIFORM_MATRIX_MODEL, modelMatrix);
-    m_shaderFrame->setUniformVec4(UNIFORM_COLOR,
-        m_lightsEnabled
-        ? COLOR_LIGHT_SUN_ON
-        : COLOR_LIGHT_SUN_OFF);
-
+void Renderer::renderLights() {
     // render sun
-    Shader::bindVAO(m_lightVAO);
-    glDrawArrays(GL_TRIANGLES, 0, 36);
-
-    // set shader uniforms for moon
-    modelMatrix = getWorldOrientation()
-        * glm::translate(glm::mat4(), m_moonPosition)
-        * glm::scale(glm::mat4(), LIGHT_SCALE);
-    m_shaderFrame->setUniformMat4(UNIFORM_MATRIX_MODEL, modelMatrix);
-    m_shaderFrame->setUniformVec4(UNIFORM_COLOR,
-        m_lightsEnabled
-        ? COLOR_LIGHT_MOON_ON
-        : COLOR_LIGHT_MOON_OFF);
+    GLState::useProgram(m_shaderFrame->getProgramID());
+    GLState::bindVertexArray(m_lightVAO);
+    m_shaderFrame->setUniform(UNIFORM_DRAW_INDEX, Rendering::DRAW_SUN);
+    glDrawElements(GL_TRIANGLES, m_lightIndexCount, m_lightIndexType, 0);
 
     // render moon
-    glDrawArrays(GL_TRIANGLES, 0, 36);
+    m_shaderFrame->setUniform(UNIFORM_DRAW_INDEX, Rendering::DRAW_MOON);
+    glDrawElements(GL_TRIANGLES, m_lightIndexCount, m_lightIndexType, 0);
 }
 
-void Renderer::renderModels(Shader* shader, GLfloat deltaTime) {
-    // cull front faces to limit peter panning
-    glCullFace(GL_FRONT);
+void Renderer::updateModels(GLfloat deltaTime) {
+    PROFILE_ZONE("Renderer::updateModels");
 
     // collision detection
     std::vector<Model*> collidingModels
         = Collision::detectCollisions(m_models);
 
-    // render models
+    // update models
     GLuint modelIndex{ 0 };
+    m_modelInstances.clear();
     for (std::vector<Model*>::iterator m_it{ m_models.begin() };
         m_it != m_models.end();
         ++m_it) {
@@ -1579,138 +1420,242 @@ void Renderer::renderModels(Shader* shader, GLfloat deltaTime) {
             m_animations.at(modelIndex)->play(*m_it, deltaTime);
         }
 
-        // set shader attributes
-        if (shader == m_shaderShadow)
-            (*m_it)->setDepthShaderAttributes(shader);
-        else if (shader == m_shaderEntity)
-            (*m_it)->setColorShaderAttributes(shader);
-
-        // render model hierarchy
+        // collect model entity world matrices and colors
         Model::ModelHierarchy* hierarchy = (*m_it)->getHierarchy();
         for (Model::ModelHierarchy::const_iterator e_it{ hierarchy->begin() };
             e_it != hierarchy->end();
-            ++e_it) {
-
-            // compute entity model matrix
-            glm::mat4 modelMatrix;
-            modelMatrix *= glm::scale(modelMatrix,
-                    e_it->first->getScalingRelative())
-                * getWorldOrientation()
-                * (*m_it)->getModelMatrix(e_it->first)
-                * e_it->first->getScalingMatrix();
-
-            // set shader uniforms
-            Shader::useProgram(shader->getProgramID());
-            shader->setUniformMat4(UNIFORM_MATRIX_MODEL,
-                modelMatrix);
-
-            // render entity
-            e_it->first->render(m_primitive);
-        }
+            ++e_it)
+            m_modelInstances.push_back({
+                e_it->first->getModelMatrix(getWorldOrientation()
+                    * (*m_it)->getModelMatrix(e_it->first)),
+                e_it->first->getColor() });
 
         // update path index
         ++modelIndex;
     }
 
-    // go back to culling back faces
-    glCullFace(GL_BACK);
 }
 
-void Renderer::renderParticles(GLfloat deltaTime,
-    const glm::vec3& origin) {
+void Renderer::renderModels(Shader* shader,
+    const std::vector<ModelInstance>& instances) {
+    PROFILE_ZONE("Renderer::renderModels");
 
-    for (GLuint i{ 0 }; i != PARTICLE_COUNT; ++i) {
-        if (m_particles.at(i)->m_life < 0.0f
-            || m_particles.at(i)->m_position.y < 0.0f) {
-            m_particles.at(i)->m_life = 10.0f;
-            m_particles.at(i)->m_position = glm::vec3(
-                static_cast<GLfloat>(rand() % GRID_SIZE - POSITION_MAX),
-                LIGHT_POSITION_NOON.y + static_cast<GLfloat>(rand() % 65),
-                static_cast<GLfloat>(rand() % GRID_SIZE - POSITION_MAX));
-        }
-    }
+    // model entities all share the same vertex data: bind their vertex
+    // array object once and render every model in a single instanced draw call
+    if (instances.empty())
+        return;
 
-    glm::vec3 particleData[PARTICLE_COUNT];
-    GLuint particleCount = 0;
-    for (GLuint i{ 0 }; i != PARTICLE_COUNT; ++i) {
-        Particle* p = m_particles.at(i);
+    // cull front faces to limit peter panning
+    GLState::setCullFace(GL_FRONT);
 
-        if (p->m_life > 0.0f) {
-            p->m_life -= deltaTime;
+    RenderedEntity* entity{ m_models.front()->getHierarchy()->begin()->first };
+    if (shader == m_shaderShadow || shader == m_shaderShadowCascade)
+        entity->bindDepthVertexArray();
+    else if (shader == m_shaderEntity)
+        entity->bindVertexArray();
 
-            if (p->m_life > 0.0f) {
-                p->m_velocity = glm::vec3(0.0f,
-                    -9.81f,
-                    0.0f)
-                    * 100.0f
-                    * deltaTime;
-                p->m_position.y += p->m_velocity.y * deltaTime;
+    GLState::useProgram(shader->getProgramID());
+    shader->setUniform(UNIFORM_INSTANCED, true);
+    entity->renderInstanced(m_primitive, instances);
+    shader->setUniform(UNIFORM_INSTANCED, false);
 
-                p->m_distanceToCamera = glm::length(p->m_position
-                    - Camera::get().getPosition());
+    // go back to culling back faces
+    GLState::setCullFace(GL_BACK);
+}
+
+void Renderer::updateShadowCasters() {
+    // models whose entity matrices have not changed for a while join the
+    // static shadow layer, any change moves them back to the dynamic one
+    bool staticChanged{ m_modelStillFrames.size() != m_models.size()
+        || m_previousModelInstances.size() != m_modelInstances.size() };
+    if (staticChanged) {
+        m_modelStillFrames.assign(m_models.size(), 0);
+        m_previousModelInstances = m_modelInstances;
+    }
 
-                particleData[particleCount].x = p->m_position.x;
-                particleData[particleCount].y = p->m_position.y;
-                particleData[particleCount].z = p->m_position.z;
+    m_staticModels.clear();
+    m_dynamicModels.clear();
+    m_modelInstanceOffsets.assign(1, 0);
+    for (GLuint i{ 0 }; i != m_models.size(); ++i) {
+        GLuint offset{ m_modelInstanceOffsets.back() };
+        GLuint count{ static_cast<GLuint>(m_models.at(i)->getHierarchy()->size()) };
+        m_modelInstanceOffsets.push_back(offset + count);
+
+        bool moved{ false };
+        for (GLuint j{ offset }; j != offset + count; ++j)
+            if (m_modelInstances.at(j).m_modelMatrix
+                != m_previousModelInstances.at(j).m_modelMatrix) {
+                moved = true;
+                break;
             }
 
-            else
-                p->m_distanceToCamera = -1.0f;
+        bool wasStatic{ m_modelStillFrames.at(i) >= SHADOW_STATIC_FRAMES };
+        if (moved)
+            m_modelStillFrames.at(i) = 0;
+        else if (!wasStatic)
+            ++m_modelStillFrames.at(i);
+        bool isStatic{ m_modelStillFrames.at(i) >= SHADOW_STATIC_FRAMES };
+        if (isStatic != wasStatic)
+            staticChanged = true;
+
+        if (isStatic)
+            m_staticModels.push_back(i);
+        else
+            m_dynamicModels.push_back(i);
+    }
+    m_previousModelInstances = m_modelInstances;
 
-            ++particleCount;
-        }
+    if (staticChanged) {
+        m_shadowMap->invalidateStaticLayer();
+        m_cascadedShadowMap->invalidate();
     }
+}
+
+bool Renderer::haveShadowCastersMoved() const {
+    // compare dynamic casters with those last rendered to the shadow map
+    std::vector<ModelInstance>::const_iterator rendered{
+        m_shadowModelInstances.begin() };
+    for (std::vector<GLuint>::const_iterator it{ m_dynamicModels.begin() };
+        it != m_dynamicModels.end();
+        ++it)
+        for (GLuint j{ m_modelInstanceOffsets.at(*it) };
+            j != m_modelInstanceOffsets.at(*it + 1);
+            ++j, ++rendered)
+            if (rendered == m_shadowModelInstances.end()
+                || rendered->m_modelMatrix != m_modelInstances.at(j).m_modelMatrix)
+                return true;
+
+    return rendered != m_shadowModelInstances.end();
+}
+
+void Renderer::recordShadowCasters() {
+    // remember the dynamic casters rendered this time
+    m_shadowModelInstances.clear();
+    for (std::vector<GLuint>::const_iterator it{ m_dynamicModels.begin() };
+        it != m_dynamicModels.end();
+        ++it)
+        m_shadowModelInstances.insert(m_shadowModelInstances.end(),
+            m_modelInstances.begin() + m_modelInstanceOffsets.at(*it),
+            m_modelInstances.begin() + m_modelInstanceOffsets.at(*it + 1));
+}
+
+void Renderer::cullShadowCasters(const std::vector<GLuint>& models,
+    const glm::mat4& faceTransform,
+    std::vector<ModelInstance>& instances) const {
+    // keep the entities of models whose scaled collider spheres (in world
+    // space) reach into the cubemap face or cascade
+    instances.clear();
+    for (std::vector<GLuint>::const_iterator it{ models.begin() };
+        it != models.end();
+        ++it) {
+        const Model* model{ m_models.at(*it) };
+        glm::vec3 center{ getWorldOrientation()
+            * glm::vec4(model->getPosition() * model->getScale(), 1.0f) };
+        GLfloat radius{ (model->getColliderRadius() + SHADOW_CULL_MARGIN)
+            * model->getScale() };
+        if (Collision::isSphereInFrustum(faceTransform, center, radius))
+            instances.insert(instances.end(),
+                m_modelInstances.begin() + m_modelInstanceOffsets.at(*it),
+                m_modelInstances.begin() + m_modelInstanceOffsets.at(*it + 1));
+    }
+}
+
+void Renderer::renderShadowFace(Shader* shader,
+    const glm::mat4& faceTransform,
+    bool ground,
+    GLfloat deltaTime) {
+    // queue the casters of one cubemap face or cascade (ground and models
+    // already culled), distances are measured from the light
+    glm::vec3 eye{ m_lights.at(0)->getPosition() };
+    shader->setUniform(UNIFORM_SHADOW_TRANSFORM, faceTransform);
+
+    m_renderQueue.clear();
+    if (ground)
+        m_renderQueue.submit(Rendering::FIRST,
+            Rendering::SOLID,
+            Rendering::GROUND,
+            shader,
+            MATERIAL_INDEX_NONE,
+            m_entities.at(0)->getDepthVAO(),
+            getDrawableDistance(Rendering::GROUND, eye));
+    if (!m_shadowModelInstances.empty())
+        m_renderQueue.submit(Rendering::FIRST,
+            Rendering::SOLID,
+            Rendering::MODELS,
+            shader,
+            MATERIAL_INDEX_NONE,
+            m_models.front()->getHierarchy()->begin()->first->getDepthVAO(),
+            getDrawableDistance(Rendering::MODELS, eye));
+    m_renderQueue.sort();
+    renderQueuedItems(deltaTime);
+}
+
+void Renderer::allocateShadowMaps() {
+    // only the depth texture of the current shadow mode has storage
+    if (m_shadowMode == Shadows::DIRECTIONAL) {
+        m_shadowMap->release();
+        m_cascadedShadowMap->allocate();
+    }
+    else {
+        m_cascadedShadowMap->release();
+        m_shadowMap->allocate();
+    }
+}
+
+void Renderer::applyShadowQuality() {
+    // depth texture size and filtered taps of the shadow quality level, the
+    // depth textures are rendered again next frame
+    m_shadowMap->resize(m_shadowBudget.getShadowSize());
+    m_cascadedShadowMap->resize(m_shadowBudget.getShadowSize());
+    m_shadowFrame = 0;
+
+    // update shader properties
+    updateShadowProperties();
+}
+
+void Renderer::updateShadowBudget() {
+    // frame cost is the longer of the CPU and GPU times of the latest
+    // measured frames, waiting for vertical sync does not count (nothing
+    // to adapt while shadows are off)
+    if (!m_shadowsEnabled)
+        return;
+
+    GLdouble frameTime{ StageTimer::getFrameTime() };
+    if (GPUTimer::isEnabled())
+        frameTime = std::max(frameTime, GPUTimer::getFrameTime());
+
+    if (m_shadowBudget.update(frameTime))
+        applyShadowQuality();
+}
+
+void Renderer::renderParticles(GLfloat deltaTime,
+    const glm::vec3& origin) {
+    // update particle positions
+    GLuint particleCount = ParticleSystem::update(m_particles,
+        deltaTime,
+        Camera::get().getPosition(),
+        m_particleData.data());
+    m_liveParticles = particleCount;
 
     sortParticles();
 
-    glBindBuffer(GL_ARRAY_BUFFER, m_particleVBOPos);
-    glBufferData(GL_ARRAY_BUFFER,
-        sizeof(glm::vec3) * PARTICLE_COUNT,
-        particleData,
-        GL_STREAM_DRAW);
+    // write live particle positions to this frame's stream buffer region
+    GLintptr positionsOffset{ StreamBuffer::write(m_particleData.data(),
+        sizeof(glm::vec3) * particleCount) };
 
-    Shader::useProgram(m_shaderRain->getProgramID());
-    m_materials.at(3)->use(m_shaderRain);
-    m_shaderRain->setUniformVec3(UNIFORM_CAMERA_RIGHT,
-        Camera::get().getRightVector());
-    m_shaderRain->setUniformVec3(UNIFORM_CAMERA_UP,
-        Camera::get().getUpVector());
-    m_shaderRain->setUniformMat4(UNIFORM_MATRIX_MODEL,
+    GLState::useProgram(m_shaderRain->getProgramID());
+    m_shaderRain->setUniform(UNIFORM_MATRIX_MODEL,
         Camera::get().getWorldOrientation());
-    m_shaderRain->setUniformMat4(UNIFORM_MATRIX_VIEW,
-        Camera::get().getViewMatrix());
-    m_shaderRain->setUniformMat4(UNIFORM_MATRIX_PROJECTION,
-        Camera::get().getProjectionMatrix());
-
-    glBindVertexArray(m_particleVAO);
-    glBindBuffer(GL_ARRAY_BUFFER, m_particleVBO);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_particleEBO);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0,
-        3,
-        GL_FLOAT,
-        GL_FALSE,
-        5 * sizeof(GLfloat),
-        (void*)0);
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(1,
-        2,
-        GL_FLOAT,
-        GL_FALSE,
-        5 * sizeof(GLfloat),
-        (void*)(3 * sizeof(GLfloat)));
 
-    glBindBuffer(GL_ARRAY_BUFFER, m_particleVBOPos);
-    glEnableVertexAttribArray(2);
+    // only the instance positions move, to this frame's region
+    GLState::bindVertexArray(m_particleVAO);
+    GLState::bindBuffer(GL_ARRAY_BUFFER, StreamBuffer::getBuffer());
     glVertexAttribPointer(2,
         3,
         GL_FLOAT,
         GL_FALSE,
         3 * sizeof(GLfloat),
-        (void*)0);
-    glVertexAttribDivisor(0, 0);
-    glVertexAttribDivisor(1, 0);
-    glVertexAttribDivisor(2, 1);
+        (void*)positionsOffset);
 
     glDrawElementsInstanced(GL_TRIANGLES,
         6,
@@ -1729,6 +1674,101 @@ glm::vec3 Renderer::getWorldAxis(const glm::vec3& axis) const {
     return glm::vec3(getWorldOrientation() * glm::vec4(axis, 1.0f));
 }
 
+GLfloat Renderer::getDrawableDistance(Rendering::Drawable drawable,
+    const glm::vec3& eye) const {
+    // distance from eye to the scene space bounds of a queued element
+    glm::vec3 boundsMin{ POSITION_MIN, 0.0f, POSITION_MIN };
+    glm::vec3 boundsMax{ POSITION_MAX, 0.0f, POSITION_MAX };
+    switch (drawable) {
+    case Rendering::MODELS:
+        // models are approximated by their scaled collider spheres
+        if (m_models.empty())
+            return CAMERA_PLANE_FAR;
+        boundsMin = glm::vec3(POSITION_MAX);
+        boundsMax = glm::vec3(POSITION_MIN);
+        for (std::vector<Model*>::const_iterator it{ m_models.begin() };
+            it != m_models.end();
+            ++it) {
+            glm::vec3 center{ (*it)->getPosition() * (*it)->getScale() };
+            GLfloat radius{ (*it)->getColliderRadius() * (*it)->getScale() };
+            boundsMin = glm::min(boundsMin, center - glm::vec3(radius));
+            boundsMax = glm::max(boundsMax, center + glm::vec3(radius));
+        }
+        break;
+    case Rendering::LIGHTS:
+        boundsMin = glm::min(m_sunPosition, m_moonPosition);
+        boundsMax = glm::max(m_sunPosition, m_moonPosition);
+        break;
+    case Rendering::SKYBOX:
+    case Rendering::PARTICLES:
+        // surrounds the camera
+        return 0.0f;
+    default:
+        // ground, frame and grass cover the ground plane
+        break;
+    }
+
+    return RenderQueue::getDistance(eye, boundsMin, boundsMax);
+}
+
+Timing::Stage Renderer::getStage(Rendering::Drawable drawable) {
+    // timed stage of a queued element
+    switch (drawable) {
+    case Rendering::SKYBOX:
+        return Timing::SKYBOX;
+    case Rendering::GROUND:
+        return Timing::GROUND;
+    case Rendering::MODELS:
+        return Timing::MODELS;
+    case Rendering::LIGHTS:
+        return Timing::LIGHTS;
+    case Rendering::FRAME:
+        return Timing::FRAME;
+    case Rendering::GRASS_0:
+        return Timing::GRASS_0;
+    case Rendering::GRASS_1:
+        return Timing::GRASS_1;
+    default:
+        return Timing::PARTICLES;
+    }
+}
+
+void Renderer::updateDrawData() {
+    // ground
+    m_drawData->setDraw(Rendering::DRAW_GROUND,
+        m_entities.at(0)->getModelMatrix(getWorldOrientation()),
+        m_entities.at(0)->getColor());
+
+    // sun and moon
+    m_drawData->setDraw(Rendering::DRAW_SUN,
+        getWorldOrientation()
+        * glm::translate(glm::mat4(), m_sunPosition)
+        * glm::scale(glm::mat4(), LIGHT_SCALE),
+        m_lightsEnabled
+        ? COLOR_LIGHT_SUN_ON
+        : COLOR_LIGHT_SUN_OFF);
+    m_drawData->setDraw(Rendering::DRAW_MOON,
+        getWorldOrientation()
+        * glm::translate(glm::mat4(), m_moonPosition)
+        * glm::scale(glm::mat4(), LIGHT_SCALE),
+        m_lightsEnabled
+        ? COLOR_LIGHT_MOON_ON
+        : COLOR_LIGHT_MOON_OFF);
+
+    // axes and grid
+    for (GLuint i{ 0 }; i != 3; ++i)
+        m_drawData->setDraw(
+            static_cast<Rendering::DrawSlot>(Rendering::DRAW_AXIS_X + i),
+            getWorldOrientation()
+            * glm::rotate(glm::mat4(),
+                glm::radians(ROTATION_AXES[i].first),
+                ROTATION_AXES[i].second),
+            COLOR_AXES[i]);
+    m_drawData->setDraw(Rendering::DRAW_GRID,
+        getWorldOrientation(),
+        COLOR_GRID);
+}
+
 void Renderer::clampModelPosition(GLuint model) {
     // clamp model position
     if (m_modelPositions.at(model).x > POSITION_MAX)
@@ -1750,6 +1790,67 @@ void Renderer::clampModelScale(GLuint model) {
         m_modelScales.at(model) = glm::vec3(TRANSFORMATION_SCALE_MIN);
 }
 
+void Renderer::beginStage(Timing::Stage stage) const {
+    // start CPU and GPU timings and GL call counts of rendering stage
+    StageTimer::beginStage(stage);
+    GPUTimer::beginStage(stage);
+    GLCounters::beginStage(stage);
+}
+
+void Renderer::endStage(Timing::Stage stage) const {
+    // stop CPU and GPU timings and GL call counts of rendering stage
+    StageTimer::endStage(stage);
+    GPUTimer::endStage(stage);
+    GLCounters::endStage(stage);
+}
+
+void Renderer::updateDayNightCycle(GLfloat deltaTime) {
+    // handle day-night cycle
+    if (m_dayNightCycleEnabled) {
+        // increment time of day
+        m_currentTime += LIGHT_SPEED * deltaTime;
+
+        // update light position
+        glm::vec3 currentPosition = m_lights.at(0)->getPosition();
+        GLfloat nightTime = isNight() ? -1.0f : 1.0f;
+        GLfloat y = LIGHT_POSITION_NOON.y * sin(nightTime * m_currentTime);
+        GLfloat z = LIGHT_POSITION_NOON.y * nightTime * cos(m_currentTime);
+        glm::vec3 newPosition{ currentPosition.x, y, z };
+        m_lights.at(0)->setPosition(newPosition);
+        
+        // update light color
+        glm::vec4 currentColor = m_lights.at(0)->getColor();
+        glm::vec4 targetColor;
+
+        // night time
+        if (isNight())
+            targetColor = COLOR_LIGHT_NIGHT;
+
+        // day time
+        else if (isDay())
+            targetColor = COLOR_LIGHT_DAY;
+
+        // dawn or dusk time
+        else
+            targetColor = COLOR_LIGHT_TRANSITION;
+
+        // lerp color and assign to light and rim lighting
+        glm::vec4 newColor{ lerpColor(currentColor, targetColor, 0.1f) };
+        m_lights.at(0)->setColor(newColor);
+        m_rimLightColor = newColor;
+
+		// lerp between fog color and rim lighting color
+		m_fogColor = lerpColor(m_fogColor, m_rimLightColor, 0.6f);
+
+        // update shader properties
+        updateLightPositionsAndColors();
+
+        // reset timer after a full cycle
+        if (m_currentTime >= 2.0 * glm::pi<GLfloat>())
+            m_currentTime = 0.0f;
+    }
+}
+
 glm::vec4 Renderer::lerpColor(const glm::vec4& start,
     const glm::vec4& end,
     GLfloat step) {
@@ -1775,7 +1876,7 @@ bool Renderer::isNight() const {
 }
 
 GLint Renderer::findParticle() {
-    for (GLuint i{ 0 }; i != PARTICLE_COUNT; ++i) {
+    for (GLuint i{ 0 }; i != m_particles.size(); ++i) {
         if (m_particles.at(i)->m_life < 0.0f)
             return i;
     }
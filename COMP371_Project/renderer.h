@@ -4,18 +4,36 @@
 // project headers
 #include "animation.h"
 #include "camera.h"
+#include "cascaded_shadow_map.h"
 #include "collision.h"
+#include "config.h"
 #include "constants.h"
+#include "draw_data.h"
 #include "enums.h"
+#include "gpu_timer.h"
+#include "horse_factory.h"
+#include "hud.h"
 #include "light_source.h"
 #include "material.h"
+#include "mesh.h"
+#include "mesh_builder.h"
 #include "model.h"
+#include "overdraw_map.h"
 #include "particle.h"
+#include "particle_system.h"
 #include "path.h"
+#include "profiler.h"
+#include "recorder.h"
+#include "render_queue.h"
 #include "rendered_entity.h"
+#include "scene_uniforms.h"
 #include "shader.h"
+#include "shadow_budget.h"
 #include "shadow_map.h"
 #include "skybox.h"
+#include "stage_timer.h"
+#include "startup_report.h"
+#include "stream_buffer.h"
 #include "texture.h"
 #include "vertex_loader.h"
 
@@ -45,6 +63,7 @@ public:
     Rendering::Primitive getPrimitive() const;
     GLfloat getAnimationSpeed() const;
     GLfloat getAnimationSpeedCurrent() const;
+    bool isShadowBudgetEnabled() const;
 
     // setters
     void setPrimitive(Rendering::Primitive primitive);
@@ -70,14 +89,19 @@ public:
     void toggleDebugging();
     void toggleFog();
     void toggleFrame();
+    void toggleHud();
     void toggleLights();
+    void toggleOverdraw();
     void togglePathing();
+    void toggleShadowBudget();
+    void toggleShadowMode();
     void toggleShadows();
     void toggleTextures();
     void toggleRain();
     void updateFogProperties() const;
     void updateLightPositionsAndColors();
     void updateLightProperties() const;
+    void updateOverdrawProperties() const;
     void updateProjectionMatrix() const;
     void updateShadowProperties() const;
     void updateTextureProperties() const;
@@ -94,9 +118,15 @@ private:
         m_shaderGrass{ new Shader(PATH_VERTEX_GRASS,
             PATH_FRAGMENT_GRASS) },
         m_shaderShadow{ new Shader(PATH_VERTEX_SHADOW,
-            PATH_FRAGMENT_SHADOW,
-            PATH_GEOMETRY_SHADOW) },
+            PATH_FRAGMENT_SHADOW) },
+        m_shaderShadowCascade{ new Shader(PATH_VERTEX_SHADOW,
+            PATH_FRAGMENT_SHADOW_CASCADE) },
+        m_sceneUniforms{ new SceneUniforms() },
+        m_drawData{ new DrawData() },
         m_shadowMap{ new ShadowMap() },
+        m_cascadedShadowMap{ new CascadedShadowMap() },
+        m_overdrawMap{ new OverdrawMap() },
+        m_hud{ new Hud() },
         m_skybox{ new Skybox(PATH_VERTEX_SKYBOX,
             PATH_FRAGMENT_SKYBOX,
             PATH_TEXTURE_SKYBOX) } {
@@ -117,26 +147,59 @@ private:
 
     // rendering passes
     void renderFirstPass(GLfloat deltaTime);
+    void renderCascadedShadows(GLfloat deltaTime);
+    void renderPointShadows(GLfloat deltaTime);
     void renderSecondPass(GLfloat deltaTime);
+    void renderQueuedItems(GLfloat deltaTime);
+    void renderItem(const RenderQueue::DrawItem& item,
+        GLfloat deltaTime);
 
     // rendered elements
     void renderFrame();
-    void renderGrass(GLfloat deltaTime, GLuint grassVersion);
+    void renderGrass(GLuint grassVersion);
     void renderGround(Shader* shader);
-    void renderLights(GLfloat deltaTime);
-    void renderModels(Shader* shader, GLfloat deltaTime);
+    void renderLights();
+    void renderModels(Shader* shader,
+        const std::vector<ModelInstance>& instances);
     void renderParticles(GLfloat deltaTime,
         const glm::vec3& origin);
 
     // rendering utilities
     const glm::mat4& getWorldOrientation() const;
     glm::vec3 getWorldAxis(const glm::vec3& axis) const;
+    GLfloat getDrawableDistance(Rendering::Drawable drawable,
+        const glm::vec3& eye) const;
+    static Timing::Stage getStage(Rendering::Drawable drawable);
+    void updateDrawData();
+    void updateModels(GLfloat deltaTime);
+
+    // shadow casters
+    void updateShadowCasters();
+    bool haveShadowCastersMoved() const;
+    void recordShadowCasters();
+    void cullShadowCasters(const std::vector<GLuint>& models,
+        const glm::mat4& faceTransform,
+        std::vector<ModelInstance>& instances) const;
+    void renderShadowFace(Shader* shader,
+        const glm::mat4& faceTransform,
+        bool ground,
+        GLfloat deltaTime);
+
+    // adaptive shadow quality
+    void allocateShadowMaps();
+    void applyShadowQuality();
+    void updateShadowBudget();
 
     // transformations
     void clampModelPosition(GLuint model);
     void clampModelScale(GLuint model);
 
+    // timing
+    void beginStage(Timing::Stage stage) const;
+    void endStage(Timing::Stage stage) const;
+
     // day-night cycle
+    void updateDayNightCycle(GLfloat deltaTime);
     static glm::vec4 lerpColor(const glm::vec4& start,
         const glm::vec4& end,
         GLfloat step);
@@ -155,6 +218,15 @@ private:
     std::vector<LightSource*> m_lights;
     std::vector<Material*> m_materials;
     std::vector<Model*> m_models;
+    std::vector<ModelInstance> m_modelInstances;
+    std::vector<ModelInstance> m_previousModelInstances;
+    std::vector<ModelInstance> m_shadowModelInstances;
+    std::vector<GLuint> m_modelInstanceOffsets;
+    std::vector<GLuint> m_modelStillFrames;
+    std::vector<GLuint> m_staticModels;
+    std::vector<GLuint> m_dynamicModels;
+    RenderQueue m_renderQueue;
+    ShadowBudget m_shadowBudget;
     std::vector<Path*> m_paths;
     std::vector<RenderedEntity*> m_entities;
     std::vector<glm::vec3> m_modelPositions;
@@ -169,33 +241,47 @@ private:
     Shader* m_shaderFrame;
     Shader* m_shaderGrass;
     Shader* m_shaderShadow;
+    Shader* m_shaderShadowCascade;
+    SceneUniforms* m_sceneUniforms;
+    DrawData* m_drawData;
     ShadowMap* m_shadowMap;
+    CascadedShadowMap* m_cascadedShadowMap;
+    OverdrawMap* m_overdrawMap;
+    Hud* m_hud;
     Skybox* m_skybox;
     std::vector<Particle*> m_particles;
+    std::vector<glm::vec3> m_particleData;
     GLuint m_axesVAO;
     GLuint m_axesVBO;
     GLuint m_gridVAO;
     GLuint m_gridVBO;
     GLuint m_lightVAO;
     GLuint m_lightVBO;
-    GLuint m_grassVAO;
+    GLuint m_lightEBO;
+    GLenum m_lightIndexType;
+    GLuint m_lightIndexCount;
+    GLuint m_grassVAOs[2];
     GLuint m_grassVBO;
     GLuint m_grassVBOPos;
     GLuint m_grassVBOPos2;
     GLuint m_grassEBO;
     GLuint m_particleVAO;
     GLuint m_particleVBO;
-    GLuint m_particleVBOPos;
     GLuint m_particleEBO;
     GLfloat m_animationSpeed{ ANIMATION_SPEED };
     GLfloat m_animationSpeedCurrent{ ANIMATION_SPEED };
     GLfloat m_currentTime{ 0.0f };
+    GLuint m_liveParticles{ 0 };
+    GLuint m_shadowFrame{ 0 };
+    Shadows::Mode m_shadowMode{ Shadows::DIRECTIONAL };
     bool m_animationsEnabled{ false };
     bool m_dayNightCycleEnabled{ false };
     bool m_debuggingEnabled{ false };
     bool m_fogEnabled{ true };
     bool m_frameEnabled{ true };
+    bool m_hudEnabled{ true };
     bool m_lightsEnabled{ true };
+    bool m_overdrawEnabled{ false };
     bool m_pathingEnabled{ false };
     bool m_shadowsEnabled{ true };
     bool m_texturesEnabled{ true };
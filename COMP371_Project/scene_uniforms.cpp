@@ -0,0 +1,126 @@
+#include "scene_uniforms.h"
+
+void SceneUniforms::setCamera(const glm::mat4& viewMatrix,
+    const glm::vec3& position,
+    const glm::vec3& right,
+    const glm::vec3& up) {
+    // set view matrix, camera position and axes
+    m_camera.viewMatrix = viewMatrix;
+    m_camera.position = glm::vec4(position, 1.0f);
+    m_camera.right = glm::vec4(right, 0.0f);
+    m_camera.up = glm::vec4(up, 0.0f);
+    m_cameraChanged = true;
+}
+
+void SceneUniforms::setProjectionMatrix(const glm::mat4& projectionMatrix) {
+    // set projection matrix
+    m_camera.projectionMatrix = projectionMatrix;
+    m_cameraChanged = true;
+}
+
+void SceneUniforms::setFog(const glm::vec4& color,
+    GLfloat density,
+    bool enabled) {
+    // set fog properties
+    m_lighting.fogColor = color;
+    m_lighting.fogDensity = density;
+    m_lighting.fogEnabled = enabled;
+    m_lightingChanged = true;
+}
+
+void SceneUniforms::setLightPositionAndColor(const glm::vec3& position,
+    const glm::vec4& color) {
+    // set light position (in world space) and color
+    m_lighting.lightPosition = glm::vec4(position, 1.0f);
+    m_lighting.lightColor = color;
+    m_lightingChanged = true;
+}
+
+void SceneUniforms::setLightProperties(const glm::vec3& ambient,
+    const glm::vec3& diffuse,
+    const glm::vec3& specular,
+    GLfloat kc,
+    GLfloat kl,
+    GLfloat kq) {
+    // set light components and attenuation
+    m_lighting.lightAmbient = glm::vec4(ambient, 0.0f);
+    m_lighting.lightDiffuse = glm::vec4(diffuse, 0.0f);
+    m_lighting.lightSpecular = glm::vec4(specular, 0.0f);
+    m_lighting.lightKC = kc;
+    m_lighting.lightKL = kl;
+    m_lighting.lightKQ = kq;
+    m_lightingChanged = true;
+}
+
+void SceneUniforms::setLightPlanes(const glm::vec2& planes) {
+    // set light near and far planes
+    m_lighting.lightPlanes = planes;
+    m_lightingChanged = true;
+}
+
+void SceneUniforms::setRimLight(const glm::vec4& color,
+    GLfloat min,
+    GLfloat max) {
+    // set rim lighting properties
+    m_lighting.rimColor = color;
+    m_lighting.rimMin = min;
+    m_lighting.rimMax = max;
+    m_lightingChanged = true;
+}
+
+void SceneUniforms::free() const {
+    // free resources
+    glDeleteBuffers(1, &m_cameraUBO);
+    glDeleteBuffers(1, &m_lightingUBO);
+}
+
+void SceneUniforms::upload() {
+    // write blocks that changed since the last upload
+    if (m_cameraChanged) {
+        GLState::bindBuffer(GL_UNIFORM_BUFFER, m_cameraUBO);
+        glBufferSubData(GL_UNIFORM_BUFFER,
+            0,
+            sizeof(CameraBlock),
+            &m_camera);
+        m_cameraChanged = false;
+    }
+    if (m_lightingChanged) {
+        GLState::bindBuffer(GL_UNIFORM_BUFFER, m_lightingUBO);
+        glBufferSubData(GL_UNIFORM_BUFFER,
+            0,
+            sizeof(LightingBlock),
+            &m_lighting);
+        m_lightingChanged = false;
+    }
+    GLState::bindBuffer(GL_UNIFORM_BUFFER, NULL);
+}
+
+void SceneUniforms::initialize() {
+    // start from zeroed blocks
+    m_camera = CameraBlock();
+    m_lighting = LightingBlock();
+
+    // allocate uniform buffers and bind them to their binding points for
+    // good, shaders bind their blocks to the same points when linked
+    glGenBuffers(1, &m_cameraUBO);
+    GLState::bindBuffer(GL_UNIFORM_BUFFER, m_cameraUBO);
+    glBufferData(GL_UNIFORM_BUFFER,
+        sizeof(CameraBlock),
+        NULL,
+        GL_DYNAMIC_DRAW);
+    GLState::bindBufferBase(GL_UNIFORM_BUFFER,
+        UNIFORM_BLOCK_BINDING_CAMERA,
+        m_cameraUBO);
+
+    glGenBuffers(1, &m_lightingUBO);
+    GLState::bindBuffer(GL_UNIFORM_BUFFER, m_lightingUBO);
+    glBufferData(GL_UNIFORM_BUFFER,
+        sizeof(LightingBlock),
+        NULL,
+        GL_DYNAMIC_DRAW);
+    GLState::bindBufferBase(GL_UNIFORM_BUFFER,
+        UNIFORM_BLOCK_BINDING_LIGHTING,
+        m_lightingUBO);
+
+    GLState::bindBuffer(GL_UNIFORM_BUFFER, NULL);
+}
\ No newline at end of file
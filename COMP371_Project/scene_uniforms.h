@@ -0,0 +1,92 @@
+#ifndef SCENE_UNIFORMS_H
+#define SCENE_UNIFORMS_H
+
+// project headers
+#include "constants.h"
+#include "gl_state.h"
+
+// GLEW
+#include <gl/glew.h>
+
+// GLM
+#include <glm/glm.hpp>
+
+// per-frame state shared by the scene shaders, kept in std140 uniform
+// blocks bound once: setters only change the local copy, and upload()
+// writes each block that changed with a single buffer update
+class SceneUniforms {
+public:
+    SceneUniforms() {
+        initialize();
+    }
+
+    // setters
+    void setCamera(const glm::mat4& viewMatrix,
+        const glm::vec3& position,
+        const glm::vec3& right,
+        const glm::vec3& up);
+    void setProjectionMatrix(const glm::mat4& projectionMatrix);
+    void setFog(const glm::vec4& color,
+        GLfloat density,
+        bool enabled);
+    void setLightPositionAndColor(const glm::vec3& position,
+        const glm::vec4& color);
+    void setLightProperties(const glm::vec3& ambient,
+        const glm::vec3& diffuse,
+        const glm::vec3& specular,
+        GLfloat kc,
+        GLfloat kl,
+        GLfloat kq);
+    void setLightPlanes(const glm::vec2& planes);
+    void setRimLight(const glm::vec4& color,
+        GLfloat min,
+        GLfloat max);
+
+    // utilities
+    void free() const;
+    void upload();
+
+private:
+    // std140 layouts of the Camera and Lighting blocks, vec3 members take
+    // up a vec4 and structs and blocks are padded to a multiple of 16 bytes
+    struct CameraBlock {
+        glm::mat4 viewMatrix;
+        glm::mat4 projectionMatrix;
+        glm::vec4 position;
+        glm::vec4 right;
+        glm::vec4 up;
+    };
+
+    struct LightingBlock {
+        glm::vec4 lightColor;
+        glm::vec4 lightPosition;
+        glm::vec4 lightAmbient;
+        glm::vec4 lightDiffuse;
+        glm::vec4 lightSpecular;
+        glm::vec2 lightPlanes;
+        GLfloat lightKC;
+        GLfloat lightKL;
+        GLfloat lightKQ;
+        GLfloat lightPadding[3];
+        glm::vec4 fogColor;
+        GLfloat fogDensity;
+        GLfloat fogPadding[3];
+        glm::vec4 rimColor;
+        GLfloat rimMin;
+        GLfloat rimMax;
+        GLfloat rimPadding[2];
+        GLint fogEnabled;
+        GLint blockPadding[3];
+    };
+
+    void initialize();
+
+    CameraBlock m_camera;
+    LightingBlock m_lighting;
+    GLuint m_cameraUBO;
+    GLuint m_lightingUBO;
+    bool m_cameraChanged{ true };
+    bool m_lightingChanged{ true };
+};
+
+#endif // !SCENE_UNIFORMS_H
\ No newline at end of file
@@ -1,22 +1,15 @@
 #include "shader.h"
 
-// initially bound buffer objects
-GLuint Shader::s_VAO = NULL;
-GLuint Shader::s_VBO = NULL;
-GLuint Shader::s_EBO = NULL;
-
-// initially bound shader program
-GLuint Shader::s_program = NULL;
-
-// initially active texture unit
-GLenum Shader::s_activeTextureUnit = NULL;
-
-// initially bound textures
-GLuint Shader::s_bound2DTexture = NULL;
+// C++ standard library headers
+#include <algorithm>
 
 Shader::Shader(const std::string& pathVertex,
     const std::string& pathFragment,
     const std::string& pathGeometry) {
+    PROFILE_ZONE("Shader::Shader");
+    STARTUP_SCOPE("compile and link "
+        + pathVertex.substr(0, pathVertex.find_last_of('/')));
+
     // create shader program from specified shader files
     std::ifstream ifsVertex, ifsFragment, ifsGeometry;
     std::stringstream ssVertex, ssFragment, ssGeometry;
@@ -116,114 +109,86 @@ GLuint Shader::getProgramID() const {
     return m_programID;
 }
 
-void Shader::setUniformFloat(const std::string& uniform,
+void Shader::setUniform(const Uniform<GLfloat>& uniform,
     GLfloat value) const {
     // set a float uniform
-    glUniform1f(glGetUniformLocation(m_programID,
-        uniform.c_str()),
+    glUniform1f(findUniform(uniform.getHash(),
+        uniform.getName(),
+        GL_FLOAT),
         value);
 }
 
-void Shader::setUniformUInt(const std::string& uniform,
-    GLuint value) const {
-    // set an unsigned int uniform
-    glUniform1i(glGetUniformLocation(m_programID,
-        uniform.c_str()),
+void Shader::setUniform(const Uniform<GLint>& uniform,
+    GLint value) const {
+    // set an int or sampler uniform
+    glUniform1i(findUniform(uniform.getHash(),
+        uniform.getName(),
+        GL_INT),
         value);
 }
 
-void Shader::setUniformBool(const std::string& uniform,
+void Shader::setUniform(const Uniform<bool>& uniform,
     bool value) const {
     // set a bool uniform
-    setUniformUInt(uniform, static_cast<GLuint>(value));
+    glUniform1i(findUniform(uniform.getHash(),
+        uniform.getName(),
+        GL_BOOL),
+        static_cast<GLint>(value));
 }
 
-void Shader::setUniformMat4(const std::string& uniform,
+void Shader::setUniform(const Uniform<glm::mat4>& uniform,
     const glm::mat4& value) const {
     // set a mat4 uniform
-    glUniformMatrix4fv(glGetUniformLocation(m_programID,
-        uniform.c_str()),
+    glUniformMatrix4fv(findUniform(uniform.getHash(),
+        uniform.getName(),
+        GL_FLOAT_MAT4),
         1,
         GL_FALSE,
         &value[0][0]);
 }
 
-void Shader::setUniformVec2(const std::string& uniform,
+void Shader::setUniform(const Uniform<glm::vec2>& uniform,
     const glm::vec2& value) const {
     // set a vec2 uniform
-    glUniform2fv(glGetUniformLocation(m_programID,
-        uniform.c_str()),
+    glUniform2fv(findUniform(uniform.getHash(),
+        uniform.getName(),
+        GL_FLOAT_VEC2),
         1,
         &value[0]);
 }
 
-void Shader::setUniformVec3(const std::string& uniform,
+void Shader::setUniform(const Uniform<glm::vec3>& uniform,
     const glm::vec3& value) const {
     // set a vec3 uniform
-    glUniform3fv(glGetUniformLocation(m_programID,
-        uniform.c_str()),
+    glUniform3fv(findUniform(uniform.getHash(),
+        uniform.getName(),
+        GL_FLOAT_VEC3),
         1,
         &value[0]);
 }
 
-void Shader::setUniformVec4(const std::string& uniform,
+void Shader::setUniform(const Uniform<glm::vec4>& uniform,
     const glm::vec4& value) const {
     // set a vec4 uniform
-    glUniform4fv(glGetUniformLocation(m_programID,
-        uniform.c_str()),
+    glUniform4fv(findUniform(uniform.getHash(),
+        uniform.getName(),
+        GL_FLOAT_VEC4),
         1,
         &value[0]);
 }
 
-void Shader::activateTextureUnit(GLenum textureUnit) {
-    // activate texture unit if needed
-    if (textureUnit != s_activeTextureUnit) {
-        glActiveTexture(textureUnit);
-        s_activeTextureUnit = textureUnit;
-    }
-}
-
-void Shader::bindVAO(GLuint VAO) {
-    // bind VAO if needed
-    if (VAO != s_VAO) {
-        glBindVertexArray(VAO);
-        s_VAO = VAO;
-    }
-}
-
-void Shader::bindVBO(GLuint VBO) {
-    // bind VBO if needed
-    if (VBO != s_VBO) {
-        glBindBuffer(GL_ARRAY_BUFFER, VBO);
-        s_VBO = VBO;
-    }
-}
-
-void Shader::bindEBO(GLuint EBO) {
-    // bind EBO if needed
-    if (EBO != s_EBO) {
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-        s_EBO = EBO;
-    }
-}
-
-void Shader::bind2DTexture(GLuint texture) {
-    // bind 2D texture if needed
-    if (texture != s_bound2DTexture) {
-        glBindTexture(GL_TEXTURE_2D, texture);
-        s_bound2DTexture = texture;
-    }
-}
-
-void Shader::bindCubemapTexture(GLuint texture) {
-    // bind cubemap texture
-    glBindTexture(GL_TEXTURE_CUBE_MAP, texture);
-}
+void Shader::setUniformArray(const Uniform<glm::mat4>& uniform,
+    const std::vector<glm::mat4>& values) const {
+    // set a mat4 array uniform in a single call
+    if (values.empty())
+        return;
 
-void Shader::useProgram(GLuint programID) {
-    // use given shader program if needed
-    if (programID != s_program)
-        glUseProgram(programID);
+    glUniformMatrix4fv(findUniform(uniform.getHash(),
+        uniform.getName(),
+        GL_FLOAT_MAT4),
+        static_cast<GLsizei>(values.size()),
+        GL_FALSE,
+        &values[0][0][0]);
 }
 
 void Shader::validateProgram(GLuint programID) {
@@ -248,70 +213,6 @@ void Shader::free() const {
     glDeleteProgram(m_programID);
 }
 
-void Shader::setColorAttributes(GLuint VAO,
-    GLuint VBO,
-    GLuint EBO) {
-    // bind buffers
-    if (VAO != s_VAO) {
-        bindVAO(VAO);
-        bindVBO(VBO);
-        if (EBO != NULL)
-            bindEBO(EBO);
-
-        // vertex attributes
-        GLuint positionLocation = glGetAttribLocation(m_programID,
-            ATTRIBUTE_POSITION.c_str());
-        glVertexAttribPointer(positionLocation,
-            3,
-            GL_FLOAT,
-            GL_FALSE,
-            8 * sizeof(GLfloat),
-            (void*)0);
-        glEnableVertexAttribArray(positionLocation);
-        GLuint normalLocation = glGetAttribLocation(m_programID,
-            ATTRIBUTE_NORMAL.c_str());
-        glVertexAttribPointer(normalLocation,
-            3,
-            GL_FLOAT,
-            GL_FALSE,
-            8 * sizeof(GLfloat),
-            (void*)(3 * sizeof(GLfloat)));
-        glEnableVertexAttribArray(normalLocation);
-        GLuint textureLocation = glGetAttribLocation(m_programID,
-            ATTRIBUTE_TEXTURE.c_str());
-        glVertexAttribPointer(textureLocation,
-            2,
-            GL_FLOAT,
-            GL_FALSE,
-            8 * sizeof(GLfloat),
-            (void*)(6 * sizeof(GLfloat)));
-        glEnableVertexAttribArray(textureLocation);
-    }
-}
-
-void Shader::setDepthAttributes(GLuint VAO,
-    GLuint VBO,
-    GLuint EBO) {
-    // bind buffers
-    if (VAO != s_VAO) {
-        bindVAO(VAO);
-        bindVBO(VBO);
-        if (EBO != NULL)
-            bindEBO(EBO);
-
-        // vertex attributes
-        GLuint positionLocation = glGetAttribLocation(m_programID,
-            ATTRIBUTE_POSITION.c_str());
-        glVertexAttribPointer(positionLocation,
-            3,
-            GL_FLOAT,
-            GL_FALSE,
-            8 * sizeof(GLfloat),
-            (void*)0);
-        glEnableVertexAttribArray(positionLocation);
-    }
-}
-
 void Shader::compileShader(const std::string& shaderType,
     GLuint shaderID) const {
     // attempt to compile shader
@@ -350,7 +251,193 @@ void Shader::linkProgram(GLuint shaderVertex,
         std::cerr << ">>> Failed to link shader program: "
             << std::endl << log << std::endl;
     }
-    else
+    else {
         std::cout << "Shader program linking successful." << std::endl;
+        bindUniformBlocks();
+        reflectUniforms();
+        validateUniforms();
+    }
     std::cout << std::endl;
+}
+
+void Shader::bindUniformBlocks() const {
+    // bind shared uniform blocks declared by the program to their fixed
+    // binding points
+    GLuint cameraIndex = glGetUniformBlockIndex(m_programID,
+        UNIFORM_BLOCK_CAMERA.c_str());
+    if (cameraIndex != GL_INVALID_INDEX)
+        glUniformBlockBinding(m_programID,
+            cameraIndex,
+            UNIFORM_BLOCK_BINDING_CAMERA);
+
+    GLuint lightingIndex = glGetUniformBlockIndex(m_programID,
+        UNIFORM_BLOCK_LIGHTING.c_str());
+    if (lightingIndex != GL_INVALID_INDEX)
+        glUniformBlockBinding(m_programID,
+            lightingIndex,
+            UNIFORM_BLOCK_BINDING_LIGHTING);
+
+    GLuint drawsIndex = glGetUniformBlockIndex(m_programID,
+        UNIFORM_BLOCK_DRAWS.c_str());
+    if (drawsIndex != GL_INVALID_INDEX)
+        glUniformBlockBinding(m_programID,
+            drawsIndex,
+            UNIFORM_BLOCK_BINDING_DRAWS);
+}
+
+void Shader::reflectUniforms() {
+    // list active uniforms once so that setters never query the driver
+    GLint uniformCount{ 0 };
+    GLint nameLength{ 0 };
+    glGetProgramiv(m_programID, GL_ACTIVE_UNIFORMS, &uniformCount);
+    glGetProgramiv(m_programID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &nameLength);
+    std::vector<GLchar> buffer(std::max(nameLength, 1));
+
+    m_uniformLocations.clear();
+    for (GLint i{ 0 }; i != uniformCount; ++i) {
+        GLint size;
+        GLenum type;
+        glGetActiveUniform(m_programID,
+            i,
+            static_cast<GLsizei>(buffer.size()),
+            NULL,
+            &size,
+            &type,
+            &buffer[0]);
+        std::string name(&buffer[0]);
+
+        // uniform block members have no location
+        GLint location = glGetUniformLocation(m_programID, name.c_str());
+        if (location == -1)
+            continue;
+
+        // arrays are reported as "name[0]", register every element and the
+        // bare name, element locations are not guaranteed to be contiguous
+        std::string::size_type bracket = name.rfind("[0]");
+        if (bracket != std::string::npos && bracket + 3 == name.size()) {
+            std::string base{ name.substr(0, bracket) };
+            m_uniformLocations.push_back(UniformLocation{ base,
+                hashUniformName(base.c_str()),
+                location,
+                type });
+            m_uniformLocations.push_back(UniformLocation{ name,
+                hashUniformName(name.c_str()),
+                location,
+                type });
+            for (GLint j{ 1 }; j < size; ++j) {
+                std::string element{ base + "[" + std::to_string(j) + "]" };
+                m_uniformLocations.push_back(UniformLocation{ element,
+                    hashUniformName(element.c_str()),
+                    glGetUniformLocation(m_programID, element.c_str()),
+                    type });
+            }
+        }
+        else
+            m_uniformLocations.push_back(UniformLocation{ name,
+                hashUniformName(name.c_str()),
+                location,
+                type });
+    }
+
+    // sort by hash for binary search, names sharing a hash could not be
+    // told apart by handles
+    std::sort(m_uniformLocations.begin(),
+        m_uniformLocations.end(),
+        isHashLessThan);
+    for (GLuint i{ 1 }; i < m_uniformLocations.size(); ++i)
+        if (m_uniformLocations.at(i).hash == m_uniformLocations.at(i - 1).hash)
+            std::cerr << ">>> Uniform name hash collision: \""
+                << m_uniformLocations.at(i - 1).name << "\" and \""
+                << m_uniformLocations.at(i).name << "\"" << std::endl;
+}
+
+void Shader::validateUniforms() const {
+    // every uniform the program declares must be settable through a handle
+    // of the same type (array elements are covered by the bare name)
+    for (std::vector<UniformLocation>::const_iterator it{
+            m_uniformLocations.begin() };
+        it != m_uniformLocations.end();
+        ++it) {
+        if (it->name.find('[') != std::string::npos)
+            continue;
+
+        const UniformHandle* handle{ nullptr };
+        for (const UniformHandle& candidate : UNIFORM_HANDLES)
+            if (candidate.m_hash == it->hash)
+                handle = &candidate;
+
+        // samplers without a handle read texture unit 0
+        if (!handle) {
+            if (!isSamplerType(it->type))
+                std::cerr << ">>> Uniform \"" << it->name << "\" of shader "
+                    << "program " << m_programID << " has no handle"
+                    << std::endl;
+        }
+        else if (handle->m_type != it->type
+            && !(handle->m_type == GL_INT && isSamplerType(it->type)))
+            std::cerr << ">>> Uniform \"" << it->name << "\" of shader "
+                << "program " << m_programID << " does not match the type "
+                << "of its handle" << std::endl;
+    }
+}
+
+GLint Shader::findUniform(GLuint hash,
+    const char* name,
+    GLenum type) const {
+    // look up cached location by name hash
+    std::vector<UniformLocation>::iterator it{
+        std::lower_bound(m_uniformLocations.begin(),
+            m_uniformLocations.end(),
+            hash,
+            isHashLess) };
+    if (it != m_uniformLocations.end() && it->hash == hash) {
+        if (it->type == type
+            || it->location == -1
+            || (type == GL_INT && isSamplerType(it->type)))
+            return it->location;
+
+        // type mismatch, report once and ignore further uploads
+        std::cerr << ">>> Uniform \"" << name << "\" has a different type "
+            << "in shader program " << m_programID << std::endl;
+        it->location = -1;
+
+        return -1;
+    }
+
+    // not an active uniform of this program, report once and cache as -1
+    // which OpenGL silently ignores
+    std::cerr << ">>> Uniform \"" << name << "\" is not active "
+        << "in shader program " << m_programID << std::endl;
+    m_uniformLocations.insert(it,
+        UniformLocation{ name, hash, -1, GL_NONE });
+
+    return -1;
+}
+
+bool Shader::isHashLess(const UniformLocation& uniformLocation,
+    GLuint hash) {
+    // compare cached uniform against name hash
+    return uniformLocation.hash < hash;
+}
+
+bool Shader::isHashLessThan(const UniformLocation& a,
+    const UniformLocation& b) {
+    // compare cached uniforms by name hash
+    return a.hash < b.hash;
+}
+
+bool Shader::isSamplerType(GLenum type) {
+    // sampler uniforms are set with integer texture units
+    switch (type) {
+    case GL_SAMPLER_2D:
+    case GL_SAMPLER_2D_ARRAY:
+    case GL_SAMPLER_2D_ARRAY_SHADOW:
+    case GL_SAMPLER_2D_SHADOW:
+    case GL_SAMPLER_3D:
+    case GL_SAMPLER_CUBE:
+    case GL_SAMPLER_CUBE_SHADOW:
+        return true;
+    default:
+        return false;
+    }
 }
\ No newline at end of file
@@ -3,6 +3,10 @@
 
 // project headers
 #include "constants.h"
+#include "gl_state.h"
+#include "profiler.h"
+#include "startup_report.h"
+#include "uniform.h"
 
 // GLEW
 #include <gl/glew.h>
@@ -14,6 +18,8 @@
 #include <fstream>
 #include <iostream>
 #include <sstream>
+#include <string>
+#include <vector>
 
 class Shader {
 public:
@@ -22,59 +28,65 @@ public:
         const std::string& pathFragment,
         const std::string& pathGeometry = std::string());
     Shader(const Shader& shader)
-        : m_programID{ shader.m_programID } {}
+        : m_uniformLocations{ shader.m_uniformLocations },
+        m_programID{ shader.m_programID } {}
     Shader(Shader&& shader)
-        : m_programID{ std::move(shader.m_programID) } {}
+        : m_uniformLocations{ std::move(shader.m_uniformLocations) },
+        m_programID{ std::move(shader.m_programID) } {}
 
     // getters
     GLuint getProgramID() const;
 
-    // setters
-    void setUniformFloat(const std::string& uniform,
+    // setters (a value of the wrong type for the handle does not compile)
+    void setUniform(const Uniform<GLfloat>& uniform,
         GLfloat value) const;
-    void setUniformUInt(const std::string& uniform,
-        GLuint value) const;
-    void setUniformBool(const std::string& uniform,
+    void setUniform(const Uniform<GLint>& uniform,
+        GLint value) const;
+    void setUniform(const Uniform<bool>& uniform,
         bool value) const;
-    void setUniformMat4(const std::string& uniform,
+    void setUniform(const Uniform<glm::mat4>& uniform,
         const glm::mat4& value) const;
-    void setUniformVec2(const std::string& uniform,
+    void setUniform(const Uniform<glm::vec2>& uniform,
         const glm::vec2& value) const;
-    void setUniformVec3(const std::string& uniform,
+    void setUniform(const Uniform<glm::vec3>& uniform,
         const glm::vec3& value) const;
-    void setUniformVec4(const std::string& uniform,
+    void setUniform(const Uniform<glm::vec4>& uniform,
         const glm::vec4& value) const;
+    void setUniformArray(const Uniform<glm::mat4>& uniform,
+        const std::vector<glm::mat4>& values) const;
 
     // utilities
-    static void activateTextureUnit(GLenum textureUnit);
-    static void bindVAO(GLuint VAO);
-    static void bindVBO(GLuint VBO);
-    static void bindEBO(GLuint EBO);
-    static void bind2DTexture(GLuint texture);
-    static void bindCubemapTexture(GLuint texture);
-    static void useProgram(GLuint programID);
     static void validateProgram(GLuint programID);
     void free() const;
-    void setColorAttributes(GLuint VAO,
-        GLuint VBO,
-        GLuint EBO = NULL);
-    void setDepthAttributes(GLuint VAO,
-        GLuint VBO,
-        GLuint EBO = NULL);
 
 private:
+    // location and type of an active uniform by name hash, arrays are
+    // listed by their bare name and by element
+    struct UniformLocation {
+        std::string name;
+        GLuint hash;
+        GLint location;
+        GLenum type;
+    };
+
     void compileShader(const std::string& shaderType,
         GLuint shaderID) const;
     void linkProgram(GLuint shaderVertex,
         GLuint shaderFragment,
         GLuint shaderGeometry = NULL);
+    void bindUniformBlocks() const;
+    void reflectUniforms();
+    void validateUniforms() const;
+    GLint findUniform(GLuint hash,
+        const char* name,
+        GLenum type) const;
+    static bool isHashLess(const UniformLocation& uniformLocation,
+        GLuint hash);
+    static bool isHashLessThan(const UniformLocation& a,
+        const UniformLocation& b);
+    static bool isSamplerType(GLenum type);
 
-    static GLuint s_VAO;
-    static GLuint s_VBO;
-    static GLuint s_EBO;
-    static GLuint s_program;
-    static GLenum s_activeTextureUnit;
-    static GLuint s_bound2DTexture;
+    mutable std::vector<UniformLocation> m_uniformLocations;
     GLuint m_programID;
 };
 
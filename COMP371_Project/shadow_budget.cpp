@@ -0,0 +1,129 @@
+#include "shadow_budget.h"
+
+GLuint ShadowBudget::getGridSamples(GLuint samples) const {
+    // get filtered tap count of the current level, scaled down from the
+    // manually set count
+    samples /= SHADOW_BUDGET_SAMPLE_DIVISORS[m_level];
+
+    return samples > SHADOW_GRID_SAMPLES_MIN ? samples : SHADOW_GRID_SAMPLES_MIN;
+}
+
+GLuint ShadowBudget::getLevel() const {
+    // get current quality level, 0 is the configured quality
+    return m_level;
+}
+
+GLuint ShadowBudget::getShadowSize() const {
+    // get depth texture size of the current level, scaled down from the
+    // configured size (never empty)
+    GLuint size{ Config::get().getShadowSize()
+        / SHADOW_BUDGET_SIZE_DIVISORS[m_level] };
+
+    return size != 0 ? size : 1;
+}
+
+GLuint ShadowBudget::getUpdateInterval() const {
+    // get frames between shadow updates of the current level
+    return SHADOW_BUDGET_UPDATE_INTERVALS[m_level];
+}
+
+bool ShadowBudget::isEnabled() const {
+    // get whether quality follows the frame budget
+    return m_enabled;
+}
+
+void ShadowBudget::reset() {
+    // measure from scratch, skipping frames timed before the reset (GPU
+    // timings are read back a few frames late)
+    m_frameTime = 0.0;
+    m_framesOver = 0;
+    m_framesUnder = 0;
+    m_framesIgnored = GPU_TIMER_LATENCY + 1;
+}
+
+void ShadowBudget::toggle() {
+    // set whether quality should follow the frame budget, back to the
+    // configured quality when it should not
+    m_enabled = !m_enabled;
+    std::cout << "Adaptive shadow quality: "
+        << (m_enabled ? "ENABLED" : "DISABLED") << std::endl;
+    if (!m_enabled && m_level != 0)
+        setLevel(0);
+    m_framesUp = SHADOW_BUDGET_FRAMES_UP;
+}
+
+bool ShadowBudget::update(GLdouble frameTime) {
+    if (m_framesIgnored != 0) {
+        --m_framesIgnored;
+        return false;
+    }
+
+    // smooth the measured frame cost (in milliseconds)
+    m_frameTime = m_frameTime == 0.0
+        ? frameTime
+        : m_frameTime + (frameTime - m_frameTime) * SHADOW_BUDGET_SMOOTHING;
+    if (!m_enabled || m_budget == 0.0)
+        return false;
+
+    // count consecutive frames over the budget, or well under it
+    ++m_framesSinceChange;
+    if (m_frameTime > m_budget) {
+        ++m_framesOver;
+        m_framesUnder = 0;
+    }
+    else if (m_frameTime < m_budget * SHADOW_BUDGET_RECOVERY) {
+        ++m_framesUnder;
+        m_framesOver = 0;
+    }
+    else {
+        m_framesOver = 0;
+        m_framesUnder = 0;
+    }
+
+    // step down quickly, stepping down right after stepping up means the
+    // higher level does not fit: wait twice as long before trying it again
+    if (m_framesOver >= SHADOW_BUDGET_FRAMES_DOWN
+        && m_level + 1 != SHADOW_BUDGET_LEVELS) {
+        if (m_steppedUp && m_framesSinceChange < m_framesUp)
+            m_framesUp = m_framesUp * 2 < SHADOW_BUDGET_FRAMES_UP_MAX
+                ? m_framesUp * 2
+                : SHADOW_BUDGET_FRAMES_UP_MAX;
+        setLevel(m_level + 1);
+
+        return true;
+    }
+
+    // step up slowly
+    if (m_framesUnder >= m_framesUp
+        && m_level != 0) {
+        setLevel(m_level - 1);
+
+        return true;
+    }
+
+    return false;
+}
+
+void ShadowBudget::initialize() {
+    // frame budget from scene configuration, none when the target is 0
+    GLuint targetFPS{ Config::get().getTargetFPS() };
+    m_budget = targetFPS != 0 ? 1000.0 / targetFPS : 0.0;
+    m_enabled = targetFPS != 0;
+}
+
+void ShadowBudget::setLevel(GLuint level) {
+    // change level, measure the new one from scratch (skipping frames timed
+    // at the old level, GPU timings are read back a few frames late)
+    m_steppedUp = level < m_level;
+    m_level = level;
+    m_frameTime = 0.0;
+    m_framesOver = 0;
+    m_framesUnder = 0;
+    m_framesSinceChange = 0;
+    m_framesIgnored = GPU_TIMER_LATENCY + 1;
+    std::cout << "Shadow quality level " << m_level << ": "
+        << getShadowSize() << "x" << getShadowSize() << ", "
+        << "1/" << SHADOW_BUDGET_SAMPLE_DIVISORS[m_level]
+        << " of the samples, updated every "
+        << getUpdateInterval() << " frame(s)" << std::endl;
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+#ifndef SHADOW_BUDGET_H
+#define SHADOW_BUDGET_H
+
+// project headers
+#include "config.h"
+#include "constants.h"
+
+// GLEW
+#include <gl/glew.h>
+
+// C++ standard library headers
+#include <iostream>
+
+// adaptive shadow quality: steps down a level (smaller depth textures, fewer
+// filtered taps, less frequent shadow updates) while the measured frame cost
+// stays over the frame budget, and back up once it has stayed well under it
+// for longer; a level that did not fit is retried after a growing delay so
+// that quality does not oscillate around the budget
+class ShadowBudget {
+public:
+    ShadowBudget() {
+        initialize();
+    }
+
+    // getters
+    GLuint getGridSamples(GLuint samples) const;
+    GLuint getLevel() const;
+    GLuint getShadowSize() const;
+    GLuint getUpdateInterval() const;
+    bool isEnabled() const;
+
+    // utilities
+    void reset();
+    void toggle();
+    bool update(GLdouble frameTime);
+
+private:
+    void initialize();
+    void setLevel(GLuint level);
+
+    GLdouble m_budget;
+    GLdouble m_frameTime{ 0.0 };
+    GLuint m_level{ 0 };
+    GLuint m_framesOver{ 0 };
+    GLuint m_framesUnder{ 0 };
+    GLuint m_framesSinceChange{ 0 };
+    GLuint m_framesIgnored{ 0 };
+    GLuint m_framesUp{ SHADOW_BUDGET_FRAMES_UP };
+    bool m_enabled;
+    bool m_steppedUp{ false };
+};
+
+#endif // !SHADOW_BUDGET_H
\ No newline at end of file
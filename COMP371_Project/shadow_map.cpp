@@ -5,7 +5,7 @@ GLfloat ShadowMap::s_biasMax = SHADOW_BIAS_MAX;
 GLfloat ShadowMap::s_biasMin = SHADOW_BIAS_MIN;
 GLfloat ShadowMap::s_gridFactor = SHADOW_GRID_FACTOR;
 GLfloat ShadowMap::s_gridOffset = SHADOW_GRID_OFFSET;
-GLuint ShadowMap::s_gridSamples = SHADOW_GRID_SAMPLES;
+GLuint ShadowMap::s_gridSamples = SHADOW_GRID_SAMPLES_DEFAULT;
 
 GLfloat ShadowMap::getBiasMax() {
     // get max shadow map bias
@@ -37,9 +37,24 @@ GLuint ShadowMap::getDepthTextureID() const {
     return m_depthTextureID;
 }
 
-GLuint ShadowMap::getFBOID() const {
-    // return FBO id
-    return m_FBO;
+GLuint ShadowMap::getFaceFBOID(GLuint face) const {
+    // return FBO id of a cubemap face
+    return m_faceFBOs[face];
+}
+
+GLuint ShadowMap::getStaticFaceFBOID(GLuint face) const {
+    // return static layer FBO id of a cubemap face
+    return m_staticFaceFBOs[face];
+}
+
+GLuint ShadowMap::getSize() const {
+    // return depth texture face width and height
+    return m_size;
+}
+
+bool ShadowMap::isStaticLayerValid() const {
+    // get whether the static layer matches the current static casters
+    return m_staticLayerValid;
 }
 
 void ShadowMap::adjustBiasMax(Shadows::Tweak mod) {
@@ -105,51 +120,174 @@ void ShadowMap::adjustGridSamples(Shadows::Tweak mod) {
         s_gridSamples += SHADOW_INCREMENT_GRID_SAMPLES;
         break;
     case Shadows::DECREASE:
-        s_gridSamples -= SHADOW_INCREMENT_GRID_SAMPLES;
+        s_gridSamples = s_gridSamples > SHADOW_INCREMENT_GRID_SAMPLES
+            ? s_gridSamples - SHADOW_INCREMENT_GRID_SAMPLES
+            : 0;
         break;
     }
     clampGridSamples();
     std::cout << "Shadow map grid samples: " << s_gridSamples << std::endl;
 }
 
+void ShadowMap::allocate() {
+    // allocate both textures at the current size, the static layer is
+    // rendered again
+    if (m_allocated)
+        return;
+
+    initializeDepthCubemap(m_depthTextureID, m_size);
+    initializeDepthCubemap(m_staticTextureID, m_size);
+    m_allocated = true;
+    m_staticLayerValid = false;
+
+    // check the framebuffers for problems
+    bool complete{ isComplete(m_faceFBOs) };
+    complete = isComplete(m_staticFaceFBOs) && complete;
+    if (complete)
+        std::cout << "Shadow map framebuffer complete."
+        << std::endl << std::endl;
+    else
+        std::cout << ">>> Shadow map framebuffer incomplete."
+        << std::endl << std::endl;
+
+    // unbind framebuffer
+    GLState::bindFramebuffer(NULL);
+}
+
+void ShadowMap::copyStaticLayer() const {
+    // copy each static layer face into the sampled depth texture, reading
+    // from the static layer framebuffer of that face
+    GLState::bindTexture(GL_TEXTURE_CUBE_MAP, m_depthTextureID);
+    for (GLuint face{ 0 }; face != 6; ++face) {
+        GLState::bindFramebuffer(m_staticFaceFBOs[face]);
+        glCopyTexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face,
+            0,
+            0,
+            0,
+            0,
+            0,
+            m_size,
+            m_size);
+    }
+}
+
 void ShadowMap::free() const {
     // free resources
     glDeleteVertexArrays(1, &m_VAO);
     glDeleteBuffers(1, &m_VBO);
     glDeleteBuffers(1, &m_EBO);
-    glDeleteFramebuffers(1, &m_FBO);
+    glDeleteFramebuffers(6, m_faceFBOs);
+    glDeleteFramebuffers(6, m_staticFaceFBOs);
     glDeleteTextures(1, &m_depthTextureID);
+    glDeleteTextures(1, &m_staticTextureID);
+}
+
+void ShadowMap::invalidateStaticLayer() {
+    // static casters changed, render the static layer again
+    m_staticLayerValid = false;
+}
+
+void ShadowMap::release() {
+    // drop the storage of both textures, names and framebuffers are kept
+    // for the next allocation
+    if (!m_allocated)
+        return;
+
+    initializeDepthCubemap(m_depthTextureID, 0);
+    initializeDepthCubemap(m_staticTextureID, 0);
+    m_allocated = false;
 }
 
 void ShadowMap::render(LightSource* light) const {
     // set light planes
-    Shader::useProgram(m_shaderDebug.getProgramID());
-    m_shaderDebug.setUniformVec2(UNIFORM_LIGHT_PLANES,
+    GLState::useProgram(m_shaderDebug.getProgramID());
+    m_shaderDebug.setUniform(UNIFORM_LIGHT_PLANES,
         glm::vec2(light->getPlaneNear(), light->getPlaneFar()));
 
-    // set texture properties
-    Shader::activateTextureUnit(GL_TEXTURE0);
-    Shader::bindCubemapTexture(m_depthTextureID);
+    // set texture properties, depth values are read without comparison
+    GLState::activateTextureUnit(GL_TEXTURE0);
+    GLState::bindTexture(GL_TEXTURE_CUBE_MAP, m_depthTextureID);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP,
+        GL_TEXTURE_COMPARE_MODE,
+        GL_NONE);
 
     // render depth texture on debug quad
-    Shader::bindVAO(m_VAO);
+    GLState::bindVertexArray(m_VAO);
     glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+
+    // compare again for the entity shader
+    glTexParameteri(GL_TEXTURE_CUBE_MAP,
+        GL_TEXTURE_COMPARE_MODE,
+        GL_COMPARE_REF_TO_TEXTURE);
+}
+
+void ShadowMap::resize(GLuint size) {
+    // reallocate both textures if allocated, framebuffers stay attached
+    if (size == m_size)
+        return;
+
+    m_size = size;
+    if (!m_allocated)
+        return;
+
+    initializeDepthCubemap(m_depthTextureID, m_size);
+    initializeDepthCubemap(m_staticTextureID, m_size);
+    m_staticLayerValid = false;
+}
+
+void ShadowMap::setStaticState(const glm::vec3& lightPosition,
+    const glm::mat4& worldOrientation) {
+    // the static layer is only valid for the light position and world
+    // orientation it was rendered with
+    if (lightPosition != m_staticLightPosition
+        || worldOrientation != m_staticWorldOrientation) {
+        m_staticLightPosition = lightPosition;
+        m_staticWorldOrientation = worldOrientation;
+        m_staticLayerValid = false;
+    }
+}
+
+void ShadowMap::validateStaticLayer() {
+    // static layer rendered
+    m_staticLayerValid = true;
 }
 
 void ShadowMap::initialize() {
-    // generate and bind framebuffer
-    glGenFramebuffers(1, &m_FBO);
-    glBindFramebuffer(GL_FRAMEBUFFER, m_FBO);
-    
-    // generate cubemap texture
+    // initial grid sample count from scene configuration
+    s_gridSamples = Config::get().getShadowGridSamples();
+    clampGridSamples();
+
+    // generate sampled and static layer cubemap textures, storage is
+    // allocated when the shadow mode needs them
+    m_size = Config::get().getShadowSize();
     glGenTextures(1, &m_depthTextureID);
-    Shader::bindCubemapTexture(m_depthTextureID);
+    initializeDepthCubemap(m_depthTextureID, 0);
+    glGenTextures(1, &m_staticTextureID);
+    initializeDepthCubemap(m_staticTextureID, 0);
+
+    // generate one framebuffer per face of each texture
+    initializeFaceFramebuffers(m_depthTextureID, m_faceFBOs);
+    initializeFaceFramebuffers(m_staticTextureID, m_staticFaceFBOs);
+
+    // unbind framebuffer
+    GLState::bindFramebuffer(NULL);
+
+    // set shader uniform
+    GLState::useProgram(m_shaderDebug.getProgramID());
+    m_shaderDebug.setUniform(UNIFORM_SHADOW_DEPTH_TEXTURE,
+        0);
+}
+
+void ShadowMap::initializeDepthCubemap(GLuint textureID,
+    GLuint size) {
+    // allocate cubemap depth faces (square, as cubemap faces must be)
+    GLState::bindTexture(GL_TEXTURE_CUBE_MAP, textureID);
     for (GLuint face{ 0 }; face != 6; ++face)
         glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face,
             0,
             GL_DEPTH_COMPONENT24,
-            SHADOW_DEPTH_TEXTURE_WIDTH,
-            SHADOW_DEPTH_TEXTURE_HEIGHT,
+            size,
+            size,
             0,
             GL_DEPTH_COMPONENT,
             GL_FLOAT,
@@ -171,40 +309,52 @@ void ShadowMap::initialize() {
         GL_TEXTURE_BORDER_COLOR,
         SHADOW_BORDER_COLOR);
 
+    // compare against the depth texture when sampled, linear filtering then
+    // blends the results of the four nearest texels
+    glTexParameteri(GL_TEXTURE_CUBE_MAP,
+        GL_TEXTURE_COMPARE_MODE,
+        GL_COMPARE_REF_TO_TEXTURE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP,
+        GL_TEXTURE_COMPARE_FUNC,
+        GL_LEQUAL);
+
     // set texture filtering parameters
     glTexParameteri(GL_TEXTURE_CUBE_MAP,
         GL_TEXTURE_MIN_FILTER,
-        GL_NEAREST);
+        GL_LINEAR);
     glTexParameteri(GL_TEXTURE_CUBE_MAP,
         GL_TEXTURE_MAG_FILTER,
-        GL_NEAREST);
-
-    // use texture as depth attachment
-    glFramebufferTexture(GL_FRAMEBUFFER,
-        GL_DEPTH_ATTACHMENT,
-        m_depthTextureID,
-        0);
-
-    // framebuffer will not use a color buffer, use GL_NONE
-    glDrawBuffer(GL_NONE);
-    glReadBuffer(GL_NONE);
+        GL_LINEAR);
+}
 
-    // check the framebuffer for problems
-    if (glCheckFramebufferStatus(GL_FRAMEBUFFER)
-        == GL_FRAMEBUFFER_COMPLETE)
-        std::cout << "Shadow map framebuffer complete."
-        << std::endl << std::endl;
-    else
-        std::cout << ">>> Shadow map framebuffer incomplete."
-        << std::endl << std::endl;
+void ShadowMap::initializeFaceFramebuffers(GLuint textureID,
+    GLuint (&FBOs)[6]) {
+    // attach each cubemap face as depth attachment of its own framebuffer,
+    // framebuffers will not use a color buffer
+    glGenFramebuffers(6, FBOs);
+    for (GLuint face{ 0 }; face != 6; ++face) {
+        GLState::bindFramebuffer(FBOs[face]);
+        glFramebufferTexture2D(GL_FRAMEBUFFER,
+            GL_DEPTH_ATTACHMENT,
+            GL_TEXTURE_CUBE_MAP_POSITIVE_X + face,
+            textureID,
+            0);
+        glDrawBuffer(GL_NONE);
+        glReadBuffer(GL_NONE);
+    }
+}
 
-    // unbind framebuffer
-    glBindFramebuffer(GL_FRAMEBUFFER, NULL);
+bool ShadowMap::isComplete(const GLuint (&FBOs)[6]) {
+    // check the framebuffer of each face
+    bool complete{ true };
+    for (GLuint face{ 0 }; face != 6; ++face) {
+        GLState::bindFramebuffer(FBOs[face]);
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER)
+            != GL_FRAMEBUFFER_COMPLETE)
+            complete = false;
+    }
 
-    // set shader uniform
-    Shader::useProgram(m_shaderDebug.getProgramID());
-    m_shaderDebug.setUniformUInt(UNIFORM_SHADOW_DEPTH_TEXTURE,
-        0);
+    return complete;
 }
 
 void ShadowMap::initializeDebugQuad() {
@@ -224,11 +374,11 @@ void ShadowMap::initializeDebugQuad() {
 
     // generate and bind vertex array object
     glGenVertexArrays(1, &m_VAO);
-    Shader::bindVAO(m_VAO);
+    GLState::bindVertexArray(m_VAO);
 
     // generate and bind vertex buffer object, buffer data
     glGenBuffers(1, &m_VBO);
-    Shader::bindVBO(m_VBO);
+    GLState::bindBuffer(GL_ARRAY_BUFFER, m_VBO);
     glBufferData(GL_ARRAY_BUFFER,
         sizeof(vertices),
         vertices,
@@ -236,7 +386,7 @@ void ShadowMap::initializeDebugQuad() {
 
     // generate and bind element array buffer object, buffer data
     glGenBuffers(1, &m_EBO);
-    Shader::bindEBO(m_EBO);
+    GLState::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER,
         sizeof(indices),
         indices,
@@ -296,9 +446,9 @@ void ShadowMap::clampGridOffset() {
 }
 
 void ShadowMap::clampGridSamples() {
-    // clamp grid sample count
-    if (s_gridSamples >= 256)
-        s_gridSamples = 256;
-    if (s_gridSamples < 0)
-        s_gridSamples = 0;
+    // clamp grid sample count to the shader's Poisson disk
+    if (s_gridSamples >= SHADOW_GRID_SAMPLES_MAX)
+        s_gridSamples = SHADOW_GRID_SAMPLES_MAX;
+    if (s_gridSamples < SHADOW_GRID_SAMPLES_MIN)
+        s_gridSamples = SHADOW_GRID_SAMPLES_MIN;
 }
\ No newline at end of file
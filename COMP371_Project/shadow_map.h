@@ -2,6 +2,7 @@
 #define SHADOW_MAP_H
 
 // project headers
+#include "config.h"
 #include "constants.h"
 #include "enums.h"
 #include "light_source.h"
@@ -10,6 +11,15 @@
 // GLEW
 #include <gl/glew.h>
 
+// GLM
+#include <glm/glm.hpp>
+
+// cubemap depth texture of the scene light, built in two layers: a static
+// layer (ground and casters that stopped moving) rendered only when the light
+// or the static casters change, and the sampled texture, a copy of the static
+// layer with the moving casters rendered over it; each face has its own
+// framebuffer so that casters are only drawn to the faces they project into;
+// texture storage only exists while the point light shadow mode is active
 class ShadowMap {
 public:
     ShadowMap() {
@@ -24,7 +34,10 @@ public:
     static GLfloat getGridOffset();
     static GLuint getGridSamples();
     GLuint getDepthTextureID() const;
-    GLuint getFBOID() const;
+    GLuint getFaceFBOID(GLuint face) const;
+    GLuint getStaticFaceFBOID(GLuint face) const;
+    GLuint getSize() const;
+    bool isStaticLayerValid() const;
 
     // utilities
     static void adjustBiasMax(Shadows::Tweak mod);
@@ -32,12 +45,25 @@ public:
     static void adjustGridFactor(Shadows::Tweak mod);
     static void adjustGridOffset(Shadows::Tweak mod);
     static void adjustGridSamples(Shadows::Tweak mod);
+    void allocate();
+    void copyStaticLayer() const;
     void free() const;
+    void invalidateStaticLayer();
+    void release();
     void render(LightSource* light) const;
+    void resize(GLuint size);
+    void setStaticState(const glm::vec3& lightPosition,
+        const glm::mat4& worldOrientation);
+    void validateStaticLayer();
 
 private:
     void initialize();
     void initializeDebugQuad();
+    static void initializeDepthCubemap(GLuint textureID,
+        GLuint size);
+    static void initializeFaceFramebuffers(GLuint textureID,
+        GLuint (&FBOs)[6]);
+    static bool isComplete(const GLuint (&FBOs)[6]);
 
     // utilities
     static void clampBiasMax();
@@ -56,8 +82,15 @@ private:
     GLuint m_VAO;
     GLuint m_VBO;
     GLuint m_EBO;
-    GLuint m_FBO;
+    GLuint m_faceFBOs[6];
+    GLuint m_staticFaceFBOs[6];
     GLuint m_depthTextureID;
+    GLuint m_staticTextureID;
+    GLuint m_size;
+    glm::vec3 m_staticLightPosition;
+    glm::mat4 m_staticWorldOrientation;
+    bool m_staticLayerValid{ false };
+    bool m_allocated{ false };
 };
 
 #endif // !SHADOW_MAP_H
\ No newline at end of file
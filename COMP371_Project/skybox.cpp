@@ -6,12 +6,13 @@ void Skybox::free() const {
     glDeleteTextures(1, &m_texture);
     glDeleteVertexArrays(1, &m_VAO);
     glDeleteBuffers(1, &m_VBO);
+    glDeleteBuffers(1, &m_EBO);
 }
 
 void Skybox::render(const glm::mat4& globalModelMatrix,
     const glm::vec3& cameraPosition) const {
     // disable depth test
-    glDisable(GL_DEPTH_TEST);
+    GLState::setCapability(GL_DEPTH_TEST, false);
 
     // compute model matrix
     glm::mat4 modelMatrix;
@@ -19,52 +20,27 @@ void Skybox::render(const glm::mat4& globalModelMatrix,
         * globalModelMatrix;
 
     // set shader uniforms
-    Shader::useProgram(m_shader.getProgramID());
-    m_shader.setUniformMat4(UNIFORM_MATRIX_MODEL,
+    GLState::useProgram(m_shader.getProgramID());
+    m_shader.setUniform(UNIFORM_MATRIX_MODEL,
         modelMatrix);
 
     // activate and bind cubemap texture
-    Shader::activateTextureUnit(m_textureUnit);
-    Shader::bindCubemapTexture(m_texture);
+    GLState::activateTextureUnit(m_textureUnit);
+    GLState::bindTexture(GL_TEXTURE_CUBE_MAP, m_texture);
 
     // bind vertex array object and render
-    Shader::bindVAO(m_VAO);
-    glDrawArrays(GL_TRIANGLES, 0, 36);
+    GLState::bindVertexArray(m_VAO);
+    glDrawElements(GL_TRIANGLES, m_indexCount, m_indexType, 0);
 
     // reenable depth test
-    glEnable(GL_DEPTH_TEST);
+    GLState::setCapability(GL_DEPTH_TEST, true);
 }
 
-void Skybox::updateFogProperties(bool fogEnabled) const {
-    // update fog properties
-    Shader::useProgram(m_shader.getProgramID());
-    m_shader.setUniformVec4(UNIFORM_FOG_COLOR,
-        COLOR_FOG);
-    m_shader.setUniformFloat(UNIFORM_FOG_DENSITY,
-        FOG_DENSITY * 25.0f);
-    m_shader.setUniformBool(UNIFORM_FOG_ENABLED,
-        fogEnabled);
-}
-
-void Skybox::updateLightColor(const glm::vec4& value) const {
-    // update light color
-    Shader::useProgram(m_shader.getProgramID());
-    m_shader.setUniformVec4(UNIFORM_LIGHT_COLOR,
-        value);
-}
-
-void Skybox::updateViewMatrix(const glm::mat4& viewMatrix) const {
-    // update view matrix
-    Shader::useProgram(m_shader.getProgramID());
-    m_shader.setUniformMat4(UNIFORM_MATRIX_VIEW,
-        viewMatrix);
-}
-
-void Skybox::updateProjectionMatrix(const glm::mat4& projectionMatrix) const {
-    // update projection matrix
-    Shader::useProgram(m_shader.getProgramID());
-    m_shader.setUniformMat4(UNIFORM_MATRIX_PROJECTION,
-        projectionMatrix);
+void Skybox::updateOverdraw(bool overdrawEnabled) const {
+    // set whether fragments should be counted instead of shaded
+    GLState::useProgram(m_shader.getProgramID());
+    m_shader.setUniform(UNIFORM_OVERDRAW_ENABLED,
+        overdrawEnabled);
 }
 
 void Skybox::initialize(const std::string (&path_textures)[6]) {
@@ -72,32 +48,42 @@ void Skybox::initialize(const std::string (&path_textures)[6]) {
     GLuint verticesSize;
     GLfloat* vertices = VertexLoader::loadCubeVertices(&verticesSize);
 
+    // build indexed mesh with half positions
+    Mesh mesh{ MeshBuilder::build(vertices,
+        verticesSize,
+        VERTEX_POSITION_COMPONENTS,
+        true) };
+    delete[] vertices;
+    m_indexType = mesh.m_layout.m_indexType;
+    m_indexCount = mesh.m_indexCount;
+
     // generate and bind vertex array object
     glGenVertexArrays(1, &m_VAO);
-    Shader::bindVAO(m_VAO);
+    GLState::bindVertexArray(m_VAO);
 
-    // generate and bind vertex buffer object, buffer data
+    // generate buffers, buffer data
     glGenBuffers(1, &m_VBO);
-    Shader::bindVBO(m_VBO);
-    glBufferData(GL_ARRAY_BUFFER,
-        verticesSize,
-        vertices,
-        GL_STATIC_DRAW);
+    glGenBuffers(1, &m_EBO);
+    MeshBuilder::upload(mesh,
+        m_VBO,
+        0,
+        m_EBO);
 
     // vertex attributes
+    GLState::bindBuffer(GL_ARRAY_BUFFER, m_VBO);
     GLuint positionLocation = glGetAttribLocation(m_shader.getProgramID(),
         ATTRIBUTE_POSITION.c_str());
     glVertexAttribPointer(positionLocation,
-        3,
-        GL_FLOAT,
+        mesh.m_layout.m_positionComponents,
+        mesh.m_layout.m_positionType,
         GL_FALSE,
-        3 * sizeof(GLfloat),
+        mesh.m_layout.m_positionStride,
         (void*)0);
     glEnableVertexAttribArray(positionLocation);
 
     // generate and bind texture
     glGenTextures(1, &m_texture);
-    Shader::bindCubemapTexture(m_texture);
+    GLState::bindTexture(GL_TEXTURE_CUBE_MAP, m_texture);
 
     // set texture wrapping parameters
     glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
@@ -113,22 +99,31 @@ void Skybox::initialize(const std::string (&path_textures)[6]) {
     int width, height, channels;
     stbi_uc* data;
     glGenTextures(1, &m_texture);
-    Shader::bindCubemapTexture(m_texture);
+    GLState::bindTexture(GL_TEXTURE_CUBE_MAP, m_texture);
     for (GLuint i = 0; i != 6; ++i) {
         std::cout << "Loading texture from file: \"" << path_textures[i]
             << "\"..." << std::endl;
-        data = stbi_load(path_textures[i].c_str(), &width, &height, &channels, 0);
+        {
+            STARTUP_SCOPE("decode " + path_textures[i]);
+            data = stbi_load(path_textures[i].c_str(), &width, &height, &channels, 0);
+        }
         if (data) {
-            glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i,
-                0,
-                GL_RGB,
-                width,
-                height,
-                0,
-                GL_RGB,
-                GL_UNSIGNED_BYTE,
-                data);
-            glGenerateMipmap(GL_TEXTURE_CUBE_MAP);
+            {
+                STARTUP_SCOPE("upload " + path_textures[i]);
+                glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i,
+                    0,
+                    GL_RGB,
+                    width,
+                    height,
+                    0,
+                    GL_RGB,
+                    GL_UNSIGNED_BYTE,
+                    data);
+            }
+            {
+                STARTUP_SCOPE("mipmaps " + path_textures[i]);
+                glGenerateMipmap(GL_TEXTURE_CUBE_MAP);
+            }
             ++successCount;
         }
         else
@@ -144,7 +139,14 @@ void Skybox::initialize(const std::string (&path_textures)[6]) {
     std::cout << std::endl;
 
     // set shader uniforms
-    Shader::useProgram(m_shader.getProgramID());
-    m_shader.setUniformUInt(UNIFORM_SKYBOX_TEXTURE,
+    GLState::useProgram(m_shader.getProgramID());
+    m_shader.setUniform(UNIFORM_SKYBOX_TEXTURE,
         m_textureUnit);
+
+    // skybox fog is denser than scene fog and keeps its color, fog toggle
+    // comes from the lighting block
+    m_shader.setUniform(UNIFORM_SKYBOX_FOG_COLOR,
+        COLOR_FOG);
+    m_shader.setUniform(UNIFORM_SKYBOX_FOG_DENSITY,
+        FOG_DENSITY * 25.0f);
 }
\ No newline at end of file
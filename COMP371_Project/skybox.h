@@ -2,6 +2,8 @@
 #define SKYBOX_H
 
 // project headers
+#include "mesh.h"
+#include "mesh_builder.h"
 #include "shader.h"
 #include "vertex_loader.h"
 
@@ -30,24 +32,27 @@ public:
         m_textureUnit{ skybox.m_textureUnit },
         m_textureIndex{ skybox.m_textureIndex },
         m_VAO{ skybox.m_VAO },
-        m_VBO{ skybox.m_VBO } {}
+        m_VBO{ skybox.m_VBO },
+        m_EBO{ skybox.m_EBO },
+        m_indexType{ skybox.m_indexType },
+        m_indexCount{ skybox.m_indexCount } {}
     Skybox(Skybox&& skybox)
         : m_shader{ std::move(skybox.m_shader) },
         m_texture{ std::move(skybox.m_texture) },
         m_textureUnit{ std::move(skybox.m_textureUnit) },
         m_textureIndex{ std::move(skybox.m_textureIndex) },
         m_VAO{ std::move(skybox.m_VAO) },
-        m_VBO{ std::move(skybox.m_VBO) } {}
+        m_VBO{ std::move(skybox.m_VBO) },
+        m_EBO{ std::move(skybox.m_EBO) },
+        m_indexType{ std::move(skybox.m_indexType) },
+        m_indexCount{ std::move(skybox.m_indexCount) } {}
     Skybox& operator=(Skybox& skybox) = delete;
 
     // utilities
     void free() const;
     void render(const glm::mat4& globalModelMatrix,
         const glm::vec3& cameraPosition) const;
-    void updateFogProperties(bool fogEnabled) const;
-    void updateLightColor(const glm::vec4& value) const;
-    void updateViewMatrix(const glm::mat4& viewMatrix) const;
-    void updateProjectionMatrix(const glm::mat4& projectionMatrix) const;
+    void updateOverdraw(bool overdrawEnabled) const;
 
 private:
     void initialize(const std::string (&path_textures)[6]);
@@ -58,6 +63,9 @@ private:
     GLuint m_textureIndex{ TEXTURE_INDEX_SKYBOX };
     GLuint m_VAO;
     GLuint m_VBO;
+    GLuint m_EBO;
+    GLenum m_indexType;
+    GLuint m_indexCount;
 };
 
 #endif // !SKYBOX_H
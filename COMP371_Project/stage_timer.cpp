@@ -0,0 +1,71 @@
+#include "stage_timer.h"
+
+// timing points
+StageTimer::Clock::time_point StageTimer::s_frameStart;
+StageTimer::Clock::time_point StageTimer::s_stageStart[Timing::STAGE_COUNT];
+
+// last completed frame timings (in milliseconds)
+GLdouble StageTimer::s_frameTime = 0.0;
+GLdouble StageTimer::s_stageTime[Timing::STAGE_COUNT] = {};
+
+// timings accumulated during the current frame
+GLdouble StageTimer::s_stageTimeCurrent[Timing::STAGE_COUNT] = {};
+
+// stages are not synchronized with the GPU by default
+bool StageTimer::s_synchronous = false;
+
+GLdouble StageTimer::getFrameTime() {
+    // get last frame duration
+    return s_frameTime;
+}
+
+GLdouble StageTimer::getStageTime(Timing::Stage stage) {
+    // get time spent in stage during last frame
+    return s_stageTime[stage];
+}
+
+bool StageTimer::isSynchronous() {
+    // get whether stages wait for the GPU to finish
+    return s_synchronous;
+}
+
+void StageTimer::setSynchronous(bool value) {
+    // set whether stages should wait for the GPU to finish, so that
+    // stage timings include GPU work instead of command submission only
+    s_synchronous = value;
+}
+
+void StageTimer::beginFrame() {
+    // reset stage timings accumulated during the current frame
+    for (GLuint i{ 0 }; i != Timing::STAGE_COUNT; ++i)
+        s_stageTimeCurrent[i] = 0.0;
+
+    s_frameStart = Clock::now();
+}
+
+void StageTimer::beginStage(Timing::Stage stage) {
+    // start timing stage
+    if (s_synchronous)
+        glFinish();
+    s_stageStart[stage] = Clock::now();
+}
+
+void StageTimer::endFrame() {
+    // publish timings of the frame that just completed
+    s_frameTime = elapsed(s_frameStart);
+    for (GLuint i{ 0 }; i != Timing::STAGE_COUNT; ++i)
+        s_stageTime[i] = s_stageTimeCurrent[i];
+}
+
+void StageTimer::endStage(Timing::Stage stage) {
+    // stop timing stage, stages run more than once per frame accumulate
+    if (s_synchronous)
+        glFinish();
+    s_stageTimeCurrent[stage] += elapsed(s_stageStart[stage]);
+}
+
+GLdouble StageTimer::elapsed(const Clock::time_point& start) {
+    // time elapsed since start (in milliseconds)
+    return std::chrono::duration<GLdouble, std::milli>(
+        Clock::now() - start).count();
+}
\ No newline at end of file
@@ -0,0 +1,48 @@
+#ifndef STAGE_TIMER_H
+#define STAGE_TIMER_H
+
+// project headers
+#include "constants.h"
+#include "enums.h"
+
+// GLEW
+#include <gl/glew.h>
+
+// C++ standard library headers
+#include <chrono>
+
+class StageTimer {
+public:
+    StageTimer() = delete;
+    StageTimer(const StageTimer& timer) = delete;
+    StageTimer(StageTimer&& timer) = delete;
+    StageTimer& operator=(StageTimer& timer) = delete;
+
+    // getters
+    static GLdouble getFrameTime();
+    static GLdouble getStageTime(Timing::Stage stage);
+    static bool isSynchronous();
+
+    // setters
+    static void setSynchronous(bool value);
+
+    // utilities
+    static void beginFrame();
+    static void beginStage(Timing::Stage stage);
+    static void endFrame();
+    static void endStage(Timing::Stage stage);
+
+private:
+    typedef std::chrono::high_resolution_clock Clock;
+
+    static GLdouble elapsed(const Clock::time_point& start);
+
+    static Clock::time_point s_frameStart;
+    static Clock::time_point s_stageStart[Timing::STAGE_COUNT];
+    static GLdouble s_frameTime;
+    static GLdouble s_stageTime[Timing::STAGE_COUNT];
+    static GLdouble s_stageTimeCurrent[Timing::STAGE_COUNT];
+    static bool s_synchronous;
+};
+
+#endif // !STAGE_TIMER_H
\ No newline at end of file
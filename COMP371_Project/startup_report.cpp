@@ -0,0 +1,124 @@
+#include "startup_report.h"
+
+// C++ standard library headers
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+// program start, as close to process start as static initialization gets
+const StartupReport::Clock::time_point StartupReport::s_start = Clock::now();
+
+// merged steps, in order of first completion
+std::vector<StartupReport::Step> StartupReport::s_steps;
+
+// time spent in nested steps, one entry per open step
+std::vector<GLdouble> StartupReport::s_nestedTimes;
+
+GLdouble StartupReport::getElapsedTime() {
+    // get time since program start (in milliseconds)
+    return std::chrono::duration<GLdouble, std::milli>(
+        Clock::now() - s_start).count();
+}
+
+void StartupReport::beginStep() {
+    // open step, nested steps report their time to it
+    s_nestedTimes.push_back(0.0);
+}
+
+void StartupReport::endStep(const std::string& name,
+    GLdouble time) {
+    // close step and report its time to the enclosing one
+    GLdouble nestedTime = s_nestedTimes.back();
+    s_nestedTimes.pop_back();
+    if (!s_nestedTimes.empty())
+        s_nestedTimes.back() += time;
+
+    // merge with previous steps of the same name
+    std::vector<Step>::iterator it{ s_steps.begin() };
+    while (it != s_steps.end() && it->name != name)
+        ++it;
+    if (it == s_steps.end()) {
+        s_steps.push_back(Step{ name, 0, 0.0, 0.0 });
+        it = s_steps.end() - 1;
+    }
+    ++it->calls;
+    it->selfTime += time - nestedTime;
+    it->totalTime += time;
+}
+
+void StartupReport::print(std::ostream& out) {
+    // print steps by decreasing self time
+    GLdouble otherTime{ 0.0 };
+    std::vector<Step> steps = getSortedSteps(otherTime);
+    GLdouble elapsed = getElapsedTime();
+
+    out << "Startup: " << std::fixed << std::setprecision(1) << elapsed
+        << " ms" << std::endl
+        << "    self ms   total ms  calls  step" << std::endl;
+    for (std::vector<Step>::const_iterator it{ steps.begin() };
+        it != steps.end();
+        ++it)
+        out << std::setw(11) << it->selfTime
+            << std::setw(11) << it->totalTime
+            << std::setw(7) << it->calls
+            << "  " << it->name << std::endl;
+    out << std::setw(11) << otherTime
+        << std::setw(11) << otherTime
+        << std::setw(7) << 1
+        << "  (outside of steps)" << std::endl << std::endl;
+    out.unsetf(std::ios_base::floatfield);
+}
+
+bool StartupReport::writeJSON(const std::string& path) {
+    // write steps by decreasing self time as JSON
+    std::ofstream file(path);
+    if (!file) {
+        std::cerr << ">>> Failed to open startup report file " << path
+            << std::endl;
+
+        return false;
+    }
+
+    GLdouble otherTime{ 0.0 };
+    std::vector<Step> steps = getSortedSteps(otherTime);
+    file << "{" << std::endl
+        << "  \"total_ms\": " << getElapsedTime() << "," << std::endl
+        << "  \"outside_steps_ms\": " << otherTime << "," << std::endl
+        << "  \"steps\": [" << std::endl;
+    for (GLuint i{ 0 }; i != steps.size(); ++i)
+        file << "    { \"name\": \"" << steps.at(i).name
+            << "\", \"calls\": " << steps.at(i).calls
+            << ", \"self_ms\": " << steps.at(i).selfTime
+            << ", \"total_ms\": " << steps.at(i).totalTime << " }"
+            << (i + 1 != steps.size() ? "," : "") << std::endl;
+    file << "  ]" << std::endl
+        << "}" << std::endl;
+
+    std::cout << "Startup report written to " << path << std::endl;
+
+    return true;
+}
+
+std::vector<StartupReport::Step> StartupReport::getSortedSteps(
+    GLdouble& otherTime) {
+    // self times add up to the time covered by outermost steps, the rest
+    // was spent outside of any step
+    GLdouble stepsTime{ 0.0 };
+    for (std::vector<Step>::const_iterator it{ s_steps.begin() };
+        it != s_steps.end();
+        ++it)
+        stepsTime += it->selfTime;
+    otherTime = std::max(getElapsedTime() - stepsTime, 0.0);
+
+    // sort by decreasing self time
+    std::vector<Step> steps(s_steps);
+    std::sort(steps.begin(), steps.end(), isSlower);
+
+    return steps;
+}
+
+bool StartupReport::isSlower(const Step& a,
+    const Step& b) {
+    // compare steps by self time
+    return a.selfTime > b.selfTime;
+}
\ No newline at end of file
@@ -0,0 +1,83 @@
+#ifndef STARTUP_REPORT_H
+#define STARTUP_REPORT_H
+
+// GLEW
+#include <gl/glew.h>
+
+// C++ standard library headers
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// scoped startup step, e.g. STARTUP_SCOPE("Renderer::initializeGrass"),
+// steps with the same name are merged
+#define STARTUP_CONCAT_INNER(a, b) a##b
+#define STARTUP_CONCAT(a, b) STARTUP_CONCAT_INNER(a, b)
+#define STARTUP_SCOPE(name) \
+    StartupScope STARTUP_CONCAT(startupScope, __LINE__)(name)
+
+// breakdown of the time spent before the first frame, by startup step
+// (main thread only)
+class StartupReport {
+public:
+    StartupReport() = delete;
+    StartupReport(const StartupReport& report) = delete;
+    StartupReport(StartupReport&& report) = delete;
+    StartupReport& operator=(StartupReport& report) = delete;
+
+    // getters
+    static GLdouble getElapsedTime();
+
+    // utilities
+    static void beginStep();
+    static void endStep(const std::string& name,
+        GLdouble time);
+    static void print(std::ostream& out = std::cout);
+    static bool writeJSON(const std::string& path);
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    // merged timings of a step (in milliseconds), self time excludes
+    // nested steps
+    struct Step {
+        std::string name;
+        GLuint calls;
+        GLdouble selfTime;
+        GLdouble totalTime;
+    };
+
+    static std::vector<Step> getSortedSteps(GLdouble& otherTime);
+    static bool isSlower(const Step& a,
+        const Step& b);
+
+    static const Clock::time_point s_start;
+    static std::vector<Step> s_steps;
+    static std::vector<GLdouble> s_nestedTimes;
+};
+
+// RAII startup step, reports its lifetime on destruction
+class StartupScope {
+public:
+    StartupScope() = delete;
+    StartupScope(const std::string& name)
+        : m_name{ name },
+        m_start{ std::chrono::steady_clock::now() } {
+        StartupReport::beginStep();
+    }
+    StartupScope(const StartupScope& scope) = delete;
+    StartupScope(StartupScope&& scope) = delete;
+    StartupScope& operator=(StartupScope& scope) = delete;
+    ~StartupScope() {
+        StartupReport::endStep(m_name,
+            std::chrono::duration<GLdouble, std::milli>(
+                std::chrono::steady_clock::now() - m_start).count());
+    }
+
+private:
+    std::string m_name;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+#endif // !STARTUP_REPORT_H
\ No newline at end of file
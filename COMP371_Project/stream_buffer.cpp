@@ -0,0 +1,165 @@
+#include "stream_buffer.h"
+
+// buffer and fences of the frames in flight
+GLuint StreamBuffer::s_buffer = NULL;
+GLsync StreamBuffer::s_fences[STREAM_BUFFER_FRAMES] = {};
+
+// size of one frame region, current region and write offset
+GLsizeiptr StreamBuffer::s_frameSize = STREAM_BUFFER_FRAME_SIZE;
+GLuint StreamBuffer::s_frame = 0;
+GLintptr StreamBuffer::s_offset = 0;
+
+// buffer state
+bool StreamBuffer::s_synchronized = false;
+bool StreamBuffer::s_initialized = false;
+
+GLuint StreamBuffer::getBuffer() {
+    // get buffer holding the written data
+    if (!s_initialized)
+        initialize();
+
+    return s_buffer;
+}
+
+bool StreamBuffer::isSynchronized() {
+    // get whether regions are guarded by fences rather than orphaned
+    if (!s_initialized)
+        initialize();
+
+    return s_synchronized;
+}
+
+void StreamBuffer::beginFrame() {
+    if (!s_initialized)
+        initialize();
+
+    // without fences, give the driver fresh storage for the whole frame
+    if (!s_synchronized) {
+        GLState::bindBuffer(GL_ARRAY_BUFFER, s_buffer);
+        glBufferData(GL_ARRAY_BUFFER,
+            s_frameSize,
+            NULL,
+            GL_STREAM_DRAW);
+        s_offset = 0;
+        return;
+    }
+
+    // advance to the oldest region, wait until the GPU is done reading it
+    // (only happens when the CPU runs STREAM_BUFFER_FRAMES frames ahead)
+    s_frame = (s_frame + 1) % STREAM_BUFFER_FRAMES;
+    if (s_fences[s_frame]) {
+        GLenum status{ GL_TIMEOUT_EXPIRED };
+        while (status == GL_TIMEOUT_EXPIRED)
+            status = glClientWaitSync(s_fences[s_frame],
+                GL_SYNC_FLUSH_COMMANDS_BIT,
+                STREAM_BUFFER_TIMEOUT);
+        if (status == GL_WAIT_FAILED)
+            std::cerr << ">>> Stream buffer fence wait failed" << std::endl;
+
+        glDeleteSync(s_fences[s_frame]);
+        s_fences[s_frame] = NULL;
+    }
+    s_offset = s_frame * s_frameSize;
+}
+
+void StreamBuffer::endFrame() {
+    // fence commands reading the current region
+    if (!s_initialized || !s_synchronized)
+        return;
+
+    s_fences[s_frame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+void StreamBuffer::free() {
+    // free fences and buffer
+    if (!s_initialized)
+        return;
+
+    for (GLuint i{ 0 }; i != STREAM_BUFFER_FRAMES; ++i)
+        if (s_fences[i]) {
+            glDeleteSync(s_fences[i]);
+            s_fences[i] = NULL;
+        }
+    glDeleteBuffers(1, &s_buffer);
+    s_buffer = NULL;
+    s_initialized = false;
+}
+
+GLintptr StreamBuffer::write(const void* data,
+    GLsizeiptr size) {
+    if (!s_initialized)
+        initialize();
+
+    // align write offset for vertex attribute fetches
+    GLintptr frameBegin{ s_synchronized ? s_frame * s_frameSize : 0 };
+    GLintptr offset{ (s_offset + STREAM_BUFFER_ALIGNMENT - 1)
+        / STREAM_BUFFER_ALIGNMENT * STREAM_BUFFER_ALIGNMENT };
+    if (size <= 0)
+        return offset;
+
+    // grow buffer if the current region is full, draws already issued keep
+    // reading the orphaned storage
+    if (offset + size > frameBegin + s_frameSize) {
+        GLsizeiptr frameSize{ s_frameSize * 2 };
+        while (frameSize < size)
+            frameSize *= 2;
+        allocate(frameSize);
+        frameBegin = s_synchronized ? s_frame * s_frameSize : 0;
+        offset = frameBegin;
+    }
+    s_offset = offset + size;
+
+    // copy data to the region, falling back on a plain upload if mapping fails
+    GLState::bindBuffer(GL_ARRAY_BUFFER, s_buffer);
+    void* mapped{ nullptr };
+    if (s_synchronized)
+        mapped = glMapBufferRange(GL_ARRAY_BUFFER,
+            offset,
+            size,
+            GL_MAP_WRITE_BIT
+            | GL_MAP_UNSYNCHRONIZED_BIT
+            | GL_MAP_INVALIDATE_RANGE_BIT);
+    if (mapped) {
+        std::memcpy(mapped, data, size);
+        if (!glUnmapBuffer(GL_ARRAY_BUFFER))
+            std::cerr << ">>> Stream buffer contents lost while mapped" << std::endl;
+        GLCounters::add(GLCalls::BUFFER_DATA);
+        GLCounters::add(GLCalls::UPLOADED_BYTES, size);
+    }
+    else
+        glBufferSubData(GL_ARRAY_BUFFER,
+            offset,
+            size,
+            data);
+
+    return offset;
+}
+
+void StreamBuffer::initialize() {
+    // regions need fence sync objects and unsynchronized mapping
+    s_synchronized = glFenceSync != NULL
+        && glClientWaitSync != NULL
+        && glMapBufferRange != NULL;
+
+    glGenBuffers(1, &s_buffer);
+    s_initialized = true;
+    allocate(s_frameSize);
+}
+
+void StreamBuffer::allocate(GLsizeiptr frameSize) {
+    // (re)allocate storage for all regions, the previous storage and its
+    // fences are released once the GPU no longer uses them
+    for (GLuint i{ 0 }; i != STREAM_BUFFER_FRAMES; ++i)
+        if (s_fences[i]) {
+            glDeleteSync(s_fences[i]);
+            s_fences[i] = NULL;
+        }
+
+    s_frameSize = frameSize;
+    GLState::bindBuffer(GL_ARRAY_BUFFER, s_buffer);
+    glBufferData(GL_ARRAY_BUFFER,
+        s_synchronized ? s_frameSize * STREAM_BUFFER_FRAMES : s_frameSize,
+        NULL,
+        GL_STREAM_DRAW);
+    s_offset = s_synchronized ? s_frame * s_frameSize : 0;
+}
\ No newline at end of file
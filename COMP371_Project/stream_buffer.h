@@ -0,0 +1,52 @@
+#ifndef STREAM_BUFFER_H
+#define STREAM_BUFFER_H
+
+// project headers
+#include "constants.h"
+#include "gl_state.h"
+
+// GLEW
+#include <gl/glew.h>
+
+// C++ standard library headers
+#include <cstring>
+#include <iostream>
+
+// ring buffer for vertex data rewritten every frame: each of the last
+// STREAM_BUFFER_FRAMES frames writes to its own region, mapped without
+// synchronization and guarded by a fence placed at the end of the frame,
+// so uploads never wait on draws still in flight (without fences the whole
+// buffer is orphaned at the start of each frame instead); data must be drawn
+// right after it is written, since a write that does not fit grows the buffer
+class StreamBuffer {
+public:
+    StreamBuffer() = delete;
+    StreamBuffer(const StreamBuffer& buffer) = delete;
+    StreamBuffer(StreamBuffer&& buffer) = delete;
+    StreamBuffer& operator=(StreamBuffer& buffer) = delete;
+
+    // getters
+    static GLuint getBuffer();
+    static bool isSynchronized();
+
+    // utilities
+    static void beginFrame();
+    static void endFrame();
+    static void free();
+    static GLintptr write(const void* data,
+        GLsizeiptr size);
+
+private:
+    static void initialize();
+    static void allocate(GLsizeiptr frameSize);
+
+    static GLuint s_buffer;
+    static GLsync s_fences[STREAM_BUFFER_FRAMES];
+    static GLsizeiptr s_frameSize;
+    static GLuint s_frame;
+    static GLintptr s_offset;
+    static bool s_synchronized;
+    static bool s_initialized;
+};
+
+#endif // !STREAM_BUFFER_H
\ No newline at end of file
@@ -15,9 +15,11 @@ void Texture::initialize(const std::string& path,
     GLenum format,
     GLenum wrapping,
     GLenum filtering) {    
+    PROFILE_ZONE("Texture::initialize");
+
     // generate and bind texture
     glGenTextures(1, &m_ID);
-    glBindTexture(GL_TEXTURE_2D, m_ID);
+    GLState::bindTexture(GL_TEXTURE_2D, m_ID);
 
     // set texture wrapping parameters
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrapping);
@@ -32,18 +34,28 @@ void Texture::initialize(const std::string& path,
         << "\"..." << std::endl;
     int width, height, channels;
     stbi_set_flip_vertically_on_load(true);
-    stbi_uc* data = stbi_load(path.c_str(), &width, &height, &channels, 0);
+    stbi_uc* data;
+    {
+        STARTUP_SCOPE("decode " + path);
+        data = stbi_load(path.c_str(), &width, &height, &channels, 0);
+    }
     if (data) {
-        glTexImage2D(GL_TEXTURE_2D,
-            0,
-            internal,
-            width,
-            height,
-            0,
-            format,
-            GL_UNSIGNED_BYTE,
-            data);
-        glGenerateMipmap(GL_TEXTURE_2D);
+        {
+            STARTUP_SCOPE("upload " + path);
+            glTexImage2D(GL_TEXTURE_2D,
+                0,
+                internal,
+                width,
+                height,
+                0,
+                format,
+                GL_UNSIGNED_BYTE,
+                data);
+        }
+        {
+            STARTUP_SCOPE("mipmaps " + path);
+            glGenerateMipmap(GL_TEXTURE_2D);
+        }
         std::cout << "Texture loading successful.";
     }
     else
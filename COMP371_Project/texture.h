@@ -3,6 +3,10 @@
 
 // project headers
 #include "enums.h"
+#include "gl_counters.h"
+#include "gl_state.h"
+#include "profiler.h"
+#include "startup_report.h"
 
 // GLEW
 #include <gl/glew.h>
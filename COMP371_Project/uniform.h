@@ -0,0 +1,93 @@
+#ifndef UNIFORM_H
+#define UNIFORM_H
+
+// GLEW
+#include <gl/glew.h>
+
+// GLM
+#include <glm/glm.hpp>
+
+// FNV-1a hash of a uniform name, evaluated at compile time for constant
+// handles
+constexpr GLuint hashUniformName(const char* name,
+    GLuint hash = 2166136261u) {
+    return *name == '\0'
+        ? hash
+        : hashUniformName(name + 1,
+            (hash ^ static_cast<unsigned char>(*name)) * 16777619u);
+}
+
+// GLSL type a uniform holding values of type T is declared with
+template <typename T>
+struct UniformType;
+template <>
+struct UniformType<GLfloat> {
+    static constexpr GLenum value{ GL_FLOAT };
+};
+template <>
+struct UniformType<GLint> {
+    static constexpr GLenum value{ GL_INT };
+};
+template <>
+struct UniformType<bool> {
+    static constexpr GLenum value{ GL_BOOL };
+};
+template <>
+struct UniformType<glm::mat4> {
+    static constexpr GLenum value{ GL_FLOAT_MAT4 };
+};
+template <>
+struct UniformType<glm::vec2> {
+    static constexpr GLenum value{ GL_FLOAT_VEC2 };
+};
+template <>
+struct UniformType<glm::vec3> {
+    static constexpr GLenum value{ GL_FLOAT_VEC3 };
+};
+template <>
+struct UniformType<glm::vec4> {
+    static constexpr GLenum value{ GL_FLOAT_VEC4 };
+};
+
+// typed handle to a shader uniform: shaders only accept values of type T
+// for it, and look it up by the hash of its name
+template <typename T>
+class Uniform {
+public:
+    Uniform() = delete;
+    constexpr explicit Uniform(const char* name)
+        : m_name{ name },
+        m_hash{ hashUniformName(name) } {}
+
+    // getters
+    constexpr const char* getName() const {
+        return m_name;
+    }
+    constexpr GLuint getHash() const {
+        return m_hash;
+    }
+    constexpr GLenum getType() const {
+        return UniformType<T>::value;
+    }
+
+private:
+    const char* m_name;
+    GLuint m_hash;
+};
+
+// name, hash and GLSL type of a handle of any type, so that linked programs
+// can be checked against every handle
+struct UniformHandle {
+public:
+    template <typename T>
+    constexpr UniformHandle(const Uniform<T>& uniform)
+        : m_name{ uniform.getName() },
+        m_hash{ uniform.getHash() },
+        m_type{ uniform.getType() } {}
+
+    const char* m_name;
+    GLuint m_hash;
+    GLenum m_type;
+};
+
+#endif // !UNIFORM_H
\ No newline at end of file